@@ -0,0 +1,201 @@
+/**
+ * @file main.cpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Compares the throughput of the lock-free window event buffers against
+ * the mutex guarded vectors they replaced. Exits with a non-zero status if
+ * either buffer loses or reorders events.
+ * @date 2023-10-07
+ */
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Local includes
+#include "../../src/spsc_ring.hpp"
+
+namespace {
+
+/// @brief Same size as a window key event.
+struct event
+{
+    int key;
+    int scancode;
+    int action;
+    int mods;
+};
+
+/// @brief The original implementation: a vector guarded by a mutex, copied
+/// and then cleared by the reader.
+class mutex_vector
+{
+    std::vector<event> events;
+    std::mutex eventsMutex;
+    std::vector<event> drained;
+
+  public:
+    void Push(const event& Event)
+    {
+        std::scoped_lock lock(this->eventsMutex);
+        this->events.push_back(Event);
+    }
+
+    const std::vector<event>& Drain()
+    {
+        std::scoped_lock lock(this->eventsMutex);
+        this->drained = this->events;
+        this->events.clear();
+        return this->drained;
+    }
+};
+
+/// @brief A lock-free ring whose events are copied out by the reader.
+class ring_copy
+{
+    gvw::internal::spsc_ring<event> events{ 256 };
+    std::vector<event> drained;
+
+  public:
+    void Push(const event& Event)
+    {
+        // Retry instead of dropping so that every buffer delivers every event.
+        while (!this->events.TryPush(Event)) {
+            std::this_thread::yield();
+        }
+    }
+
+    const std::vector<event>& Drain()
+    {
+        this->drained.clear();
+        this->events.PopAll(this->drained);
+        return this->drained;
+    }
+};
+
+/// @brief The current implementation: a lock-free ring read in place.
+class ring_view
+{
+    gvw::internal::spsc_ring<event> events{ 256 };
+
+  public:
+    void Push(const event& Event)
+    {
+        while (!this->events.TryPush(Event)) {
+            std::this_thread::yield();
+        }
+    }
+
+    gvw::internal::spsc_ring_view<event> Drain()
+    {
+        return this->events.Drain();
+    }
+};
+
+struct result
+{
+    double eventsPerSecond;
+    bool valid;
+};
+
+/// @brief Pushes events from one thread while another thread drains them.
+template<typename Buffer>
+result Run(size_t Event_Count)
+{
+    Buffer buffer;
+    std::atomic<bool> producing = true;
+    bool valid = true;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread consumer([&]() {
+        size_t expected = 0;
+        while (expected < Event_Count) {
+            // Read the flag first so that no events can be pushed after the
+            // final drain.
+            bool finished = !producing.load();
+            const auto& drained = buffer.Drain();
+            for (const event& event : drained) {
+                if (event.key != static_cast<int>(expected)) {
+                    valid = false;
+                }
+                ++expected;
+            }
+            if (drained.begin() == drained.end()) {
+                if (finished) {
+                    break;
+                }
+                // Let the producer run when both threads share a core.
+                std::this_thread::yield();
+            }
+        }
+        valid = valid && (expected == Event_Count);
+    });
+
+    for (size_t i = 0; i < Event_Count; ++i) {
+        buffer.Push({ static_cast<int>(i), 0, 1, 0 });
+    }
+    producing = false;
+    consumer.join();
+
+    auto duration = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start);
+    return { static_cast<double>(Event_Count) / duration.count(), valid };
+}
+
+/// @brief Returns the best of several runs.
+template<typename Buffer>
+result Best(size_t Event_Count)
+{
+    const int RUNS = 5;
+    result best = { 0.0, true };
+    for (int run = 0; run < RUNS; ++run) {
+        result current = Run<Buffer>(Event_Count);
+        best.eventsPerSecond =
+            std::max(best.eventsPerSecond, current.eventsPerSecond);
+        best.valid = best.valid && current.valid;
+    }
+    return best;
+}
+
+} // namespace
+
+int main()
+{
+    const size_t EVENT_COUNT = 10'000'000;
+    const double MILLION = 1'000'000.0;
+
+    const std::vector<std::pair<const char*, result>> RESULTS = {
+        { "mutex + vector", Best<mutex_vector>(EVENT_COUNT) },
+        { "ring, copied", Best<ring_copy>(EVENT_COUNT) },
+        { "ring, in place", Best<ring_view>(EVENT_COUNT) },
+    };
+
+    std::cout << std::left << std::setw(16) << "buffer" << std::right
+              << std::setw(18) << "million events/s" << std::setw(10)
+              << "speedup" << "\n";
+    std::cout << std::fixed << std::setprecision(2);
+    bool valid = true;
+    for (const auto& [name, result] : RESULTS) {
+        std::cout << std::left << std::setw(16) << name << std::right
+                  << std::setw(18) << result.eventsPerSecond / MILLION
+                  << std::setw(9)
+                  << result.eventsPerSecond /
+                         RESULTS.front().second.eventsPerSecond
+                  << "x\n";
+        valid = valid && result.valid;
+    }
+
+    if (!valid) {
+        std::cout << "Events were lost or reordered.\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
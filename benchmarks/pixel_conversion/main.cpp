@@ -0,0 +1,143 @@
+/**
+ * @file main.cpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Compares the vectorized pixel conversion kernels against the scalar
+ * kernels. Exits with a non-zero status if their results differ.
+ * @date 2023-09-30
+ */
+
+// Standard includes
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <vector>
+
+// Local includes
+#include "../../src/pixel_conversion.hpp"
+
+namespace {
+
+using gvw::internal::pixel_conversion_isa;
+
+using conversion = std::function<
+    void(std::span<const uint8_t>, std::span<uint8_t>, pixel_conversion_isa)>;
+
+struct benchmark
+{
+    const char* name;
+    size_t sourceComponents;
+    size_t destinationComponents;
+    conversion convert;
+};
+
+/// @brief Returns true if the vector kernel produces the same pixels as the
+/// scalar kernel for every length up to a few vectors and for `Source`.
+bool Verify(const benchmark& Benchmark,
+            const std::vector<uint8_t>& Source,
+            pixel_conversion_isa Isa)
+{
+    const size_t SHORT_PIXEL_COUNTS = 130;
+    const size_t PIXEL_COUNT = Source.size() / Benchmark.sourceComponents;
+    for (size_t pixels = 0; pixels <= PIXEL_COUNT; ++pixels) {
+        if (pixels == SHORT_PIXEL_COUNTS) {
+            pixels = PIXEL_COUNT;
+        }
+        std::span<const uint8_t> source(Source.data(),
+                                        pixels * Benchmark.sourceComponents);
+        std::vector<uint8_t> scalar(pixels * Benchmark.destinationComponents);
+        std::vector<uint8_t> vector(scalar.size());
+        Benchmark.convert(source, scalar, pixel_conversion_isa::SCALAR);
+        Benchmark.convert(source, vector, Isa);
+        if (scalar != vector) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Returns the fastest of several runs in nanoseconds per pixel.
+double Time(const benchmark& Benchmark,
+            const std::vector<uint8_t>& Source,
+            std::vector<uint8_t>& Destination,
+            pixel_conversion_isa Isa,
+            size_t Pixel_Count)
+{
+    const int RUNS = 20;
+    auto fastest = std::chrono::nanoseconds::max();
+    for (int run = 0; run < RUNS; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        Benchmark.convert(Source, Destination, Isa);
+        auto duration = std::chrono::steady_clock::now() - start;
+        fastest = std::min(
+            fastest,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration));
+    }
+    return static_cast<double>(fastest.count()) /
+           static_cast<double>(Pixel_Count);
+}
+
+} // namespace
+
+int main()
+{
+    const pixel_conversion_isa ISA = gvw::internal::GetPixelConversionIsa();
+    // An odd size exercises the scalar tail of every vector kernel.
+    const size_t PIXEL_COUNT = 2048 * 2048 + 7;
+
+    const std::vector<benchmark> BENCHMARKS = {
+        { "grey -> rgba", 1, 4, gvw::internal::ExpandGreyToRgba },
+        { "grey alpha -> rgba", 2, 4, gvw::internal::ExpandGreyAlphaToRgba },
+        { "rgb -> rgba", 3, 4, gvw::internal::ExpandRgbToRgba },
+        { "rgba -> bgra", 4, 4, gvw::internal::SwizzleRgbaToBgra },
+        { "premultiply alpha", 4, 4, gvw::internal::PremultiplyAlpha },
+    };
+
+    std::mt19937 generator(0); // NOLINT
+    std::uniform_int_distribution<int> distribution(0, UINT8_MAX);
+
+    std::cout << "Vector instruction set: "
+              << gvw::internal::GetPixelConversionIsaName(ISA) << "\n";
+    std::cout << std::left << std::setw(20) << "conversion" << std::right
+              << std::setw(14) << "scalar ns/px" << std::setw(14)
+              << "vector ns/px" << std::setw(10) << "speedup" << "\n";
+
+    bool matching = true;
+    for (const benchmark& benchmark : BENCHMARKS) {
+        std::vector<uint8_t> source(PIXEL_COUNT * benchmark.sourceComponents);
+        for (uint8_t& byte : source) {
+            byte = static_cast<uint8_t>(distribution(generator));
+        }
+
+        // Timing a kernel that produces the wrong pixels is meaningless.
+        if (!Verify(benchmark, source, ISA)) {
+            std::cout << std::left << std::setw(20) << benchmark.name
+                      << "  The vector result does not match the scalar "
+                         "result.\n";
+            matching = false;
+            continue;
+        }
+
+        std::vector<uint8_t> destination(PIXEL_COUNT *
+                                         benchmark.destinationComponents);
+        double scalarTime = Time(benchmark,
+                                 source,
+                                 destination,
+                                 pixel_conversion_isa::SCALAR,
+                                 PIXEL_COUNT);
+        double vectorTime =
+            Time(benchmark, source, destination, ISA, PIXEL_COUNT);
+
+        std::cout << std::left << std::setw(20) << benchmark.name
+                  << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(14) << scalarTime << std::setw(14) << vectorTime
+                  << std::setw(9) << std::setprecision(2)
+                  << scalarTime / vectorTime << "x\n";
+    }
+
+    return matching ? EXIT_SUCCESS : EXIT_FAILURE;
+}
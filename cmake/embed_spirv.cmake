@@ -0,0 +1,47 @@
+# Converts a SPIR-V binary into a C++ header that defines the binary as an array
+# of 32-bit words.
+#
+# Usage:
+#   cmake -D GVW_SPIRV_INPUT=<shader.spv>
+#         -D GVW_SPIRV_OUTPUT=<shader.hpp>
+#         -D GVW_SPIRV_NAME=<IDENTIFIER>
+#         -P embed_spirv.cmake
+
+foreach(GVW_REQUIRED_VARIABLE GVW_SPIRV_INPUT GVW_SPIRV_OUTPUT GVW_SPIRV_NAME)
+    if(NOT DEFINED ${GVW_REQUIRED_VARIABLE})
+        message(FATAL_ERROR "${GVW_REQUIRED_VARIABLE} is not defined.")
+    endif()
+endforeach()
+
+file(READ "${GVW_SPIRV_INPUT}" GVW_SPIRV_HEX HEX)
+string(LENGTH "${GVW_SPIRV_HEX}" GVW_SPIRV_HEX_LENGTH)
+
+# Every SPIR-V word is four bytes (eight hexadecimal digits).
+math(EXPR GVW_SPIRV_REMAINDER "${GVW_SPIRV_HEX_LENGTH} % 8")
+if(NOT GVW_SPIRV_REMAINDER EQUAL 0)
+    message(FATAL_ERROR "\"${GVW_SPIRV_INPUT}\" is not a SPIR-V binary. Its size is not a multiple of four bytes.")
+endif()
+math(EXPR GVW_SPIRV_WORD_COUNT "${GVW_SPIRV_HEX_LENGTH} / 8")
+
+# SPIR-V binaries are little-endian, so the bytes of each word are reversed.
+string(REGEX REPLACE "(..)(..)(..)(..)" "0x\\4\\3\\2\\1, " GVW_SPIRV_WORDS "${GVW_SPIRV_HEX}")
+# Place eight words on each line.
+string(REGEX REPLACE "((0x[0-9a-f]+, ){8})" "\\1\n    " GVW_SPIRV_WORDS "${GVW_SPIRV_WORDS}")
+
+file(WRITE "${GVW_SPIRV_OUTPUT}"
+"#pragma once
+
+// Generated from \"${GVW_SPIRV_INPUT}\" by embed_spirv.cmake. Do not edit.
+
+// Standard includes
+#include <array>
+#include <cstdint>
+
+namespace gvw::internal {
+
+inline constexpr std::array<uint32_t, ${GVW_SPIRV_WORD_COUNT}> ${GVW_SPIRV_NAME} = {
+    ${GVW_SPIRV_WORDS}
+};
+
+} // namespace gvw::internal
+")
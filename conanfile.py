@@ -26,6 +26,7 @@ class gvw(ConanFile):
         "gvw_shared": [True, False],
         "gvw_tests": [True, False],
         "gvw_examples": [True, False],
+        "gvw_benchmarks": [True, False],
         "fPIC": [True, False]
     }
     default_options = {
@@ -35,11 +36,12 @@ class gvw(ConanFile):
         "gvw_shared": True,
         "gvw_tests": True,
         "gvw_examples": True,
+        "gvw_benchmarks": False,
         "fPIC": True
     }
 
     # Sources
-    exports_sources = "LICENSE", "CMakeLists.txt", "gvw/*", "src/*", "examples/*", "tests/*", "utils/*"
+    exports_sources = "LICENSE", "CMakeLists.txt", "cmake/*", "gvw/*", "src/*", "shaders/*", "tools/*", "examples/*", "tests/*", "benchmarks/*", "utils/*"
 
     def validate(self):
         check_min_cppstd(self, "20")
@@ -77,7 +79,8 @@ class gvw(ConanFile):
             "-D GVW_STATIC=" + boolToCMake(self.options.gvw_static),
             "-D GVW_SHARED=" + boolToCMake(self.options.gvw_shared),
             "-D GVW_TESTS=" + boolToCMake(self.options.gvw_tests),
-            "-D GVW_EXAMPLES=" + boolToCMake(self.options.gvw_examples)
+            "-D GVW_EXAMPLES=" + boolToCMake(self.options.gvw_examples),
+            "-D GVW_BENCHMARKS=" + boolToCMake(self.options.gvw_benchmarks)
         ])
         cmake.build()
     
@@ -2,6 +2,7 @@
 #include <thread>
 #include <algorithm>
 #include <random>
+#include <filesystem>
 #include "../../gvw/gvw.hpp"
 #include "../../utils/ansiec/ansiec.hpp"
 
@@ -24,7 +25,7 @@ bool isCLeftOfLineAB(gvw::coordinate<int> A, // NOLINT
     return (B.x - A.x) * (C.y - A.y) - (B.y - A.y) * (C.x - A.x) > 0;
 }
 
-int main() // NOLINT
+int main(int Argument_Count, char** Arguments) // NOLINT
 {
     // vertex = { x, y, z }
     // color = { r, g, b }
@@ -124,10 +125,24 @@ int main() // NOLINT
     plat->DrawFrame(WHITE_VERTICES);
     std::cout << "GOT HERE 2" << std::endl;
 
-    gvw::image_file_info imageInfo = { .path = "pointer.png" };
-    auto cursorImage = gvw::CreateImage(imageInfo);
-    gvw::image_file_info otherImageInfo = { .path = "testing.png" };
-    auto otherImage = gvw::CreateImage(otherImageInfo);
+    // The archive is built next to the executable.
+    std::filesystem::path assetsPath = "assets.gvwa";
+    if (Argument_Count > 0) {
+        assetsPath =
+            std::filesystem::path(Arguments[0]).parent_path() / assetsPath;
+    }
+    gvw::archive_ptr assets = gvw::OpenArchive(assetsPath.string().c_str());
+    if (assets == nullptr) {
+        std::cerr << "Failed to open " << assetsPath << std::endl;
+        return 1;
+    }
+    auto cursorImage = assets->DecodeImage("pointer.png");
+    auto otherImage = assets->DecodeImage("testing.png");
+    if (cursorImage == nullptr || otherImage == nullptr) {
+        std::cerr << "Failed to decode the images in " << assetsPath
+                  << std::endl;
+        return 1;
+    }
     gvw::cursor_custom_shape_info cursorInfo = {
         .image = cursorImage, .hotspot = cursorImage->GetSize() / 2
     };
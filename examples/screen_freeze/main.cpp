@@ -63,8 +63,7 @@ int main() // NOLINT
         gvw->WaitThenPollEvents();
 
         for (auto& window : windows) {
-            auto keyEvents = window->GetKeyEvents();
-            for (const auto& keyEvent : keyEvents) {
+            for (const auto& keyEvent : window->DrainKeyEvents()) {
                 if (keyEvent.key == gvw::window_key::eLeftControl) {
                     if (keyEvent.action == gvw::window_key_action::ePress) {
                         leftCtrlPressed = true;
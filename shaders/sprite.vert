@@ -0,0 +1,27 @@
+#version 450
+
+// Expands one instance into a textured quad. The corners are ordered so that
+// both triangles are front facing under clockwise winding.
+
+layout(location = 0) in vec2 inPosition;
+layout(location = 1) in vec2 inSize;
+layout(location = 2) in vec2 inUvMin;
+layout(location = 3) in vec2 inUvMax;
+layout(location = 4) in vec4 inColor;
+
+layout(location = 0) out vec2 fragUv;
+layout(location = 1) out vec4 fragColor;
+
+const vec2 CORNERS[6] = vec2[](vec2(0.0, 0.0),
+                               vec2(1.0, 0.0),
+                               vec2(0.0, 1.0),
+                               vec2(0.0, 1.0),
+                               vec2(1.0, 0.0),
+                               vec2(1.0, 1.0));
+
+void main() {
+    vec2 corner = CORNERS[gl_VertexIndex];
+    gl_Position = vec4(inPosition + corner * inSize, 0.0, 1.0);
+    fragUv = mix(inUvMin, inUvMax, corner);
+    fragColor = inColor;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+/**
+ * @file archive_format.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Binary layout of GVW archives. Shared by GVW and the archive packer,
+ * so it must not depend on anything but the standard library.
+ * @date 2023-09-24
+ */
+
+// Standard includes
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace gvw::internal {
+
+/// @brief The first four bytes of every archive.
+inline constexpr std::array<char, 4> ARCHIVE_MAGIC = { 'G', 'V', 'W', 'A' };
+
+inline constexpr uint32_t ARCHIVE_VERSION = 1;
+
+/// @brief Alignment of every blob relative to the start of the archive.
+/// Archives are mapped at page boundaries, so blobs can be read in place as
+/// SPIR-V words or any other type with equal or smaller alignment.
+inline constexpr uint64_t ARCHIVE_BLOB_ALIGNMENT = 16;
+
+/// @brief The header at the start of an archive. It is followed by the table
+/// of contents, the names of all entries, and the blobs. All integers are
+/// little endian.
+struct archive_header
+{
+    std::array<char, 4> magic;
+    uint32_t version;
+    /// @brief The number of slots in the table of contents. Always a power of
+    /// two.
+    uint32_t tableSize;
+    uint32_t entryCount;
+};
+
+/// @brief A slot in the table of contents. Entries are placed at the hash of
+/// their name and collisions are resolved with linear probing. Empty slots
+/// have a `nameSize` of zero.
+struct archive_entry
+{
+    uint64_t nameHash;
+    uint64_t nameOffset;
+    uint64_t dataOffset;
+    uint64_t dataSize;
+    uint32_t nameSize;
+    uint32_t padding;
+};
+
+static_assert(sizeof(archive_header) == 16);
+static_assert(sizeof(archive_entry) == 40);
+
+/// @brief Hashes the name of an archive entry with 64-bit FNV-1a.
+constexpr uint64_t HashArchiveName(std::string_view Name)
+{
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (char character : Name) {
+        hash ^= static_cast<uint8_t>(character);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+} // namespace gvw::internal
@@ -280,7 +280,8 @@ const instance_joystick_event_callback
     instance_joystick_event_callback_config::APPEND_TO_JOYSTICK_EVENT_BUFFER =
         (instance_joystick_event_callback)[](int JID, int Event)
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    // Called while events are polled, so `GLFW_MUTEX` is already locked.
+    std::scoped_lock lock(internal::global::JOYSTICK_EVENTS_MUTEX);
     internal::global::JOYSTICK_EVENTS.emplace_back(JID, Event);
 };
 
@@ -305,9 +306,39 @@ const window_key_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->keyEventsMutex);
-    windowPtr->keyEvents.emplace_back(
-        window_key(Key), Scancode, window_key_action(Action), Mods);
+    windowPtr->keyEvents.Push(
+        { window_key(Key), Scancode, window_key_action(Action), Mods });
+};
+
+const window_key_event_callback
+    window_key_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_key_event_callback)[](GLFWwindow * Window_Handle,
+                                      int Key,
+                                      int Scancode,
+                                      int Action,
+                                      int Mods)
+{
+    window_event event = {};
+    event.type = window_event_type::eKey;
+    event.key = { window_key(Key), Scancode, window_key_action(Action), Mods };
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_key_event_callback
+    window_key_event_callback_config::CALL_EVENT_HANDLER =
+        (window_key_event_callback)[](GLFWwindow * Window_Handle,
+                                      int Key,
+                                      int Scancode,
+                                      int Action,
+                                      int Mods)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.key) {
+        windowPtr->eventHandlers.key(
+            *windowPtr,
+            { window_key(Key), Scancode, window_key_action(Action), Mods });
+    }
 };
 
 const window_character_event_callback
@@ -319,8 +350,30 @@ const window_character_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->characterEventsMutex);
-    windowPtr->characterEvents.emplace_back(Code_Point);
+    windowPtr->characterEvents.Push({ Code_Point });
+};
+
+const window_character_event_callback
+    window_character_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_character_event_callback)[](GLFWwindow * Window_Handle,
+                                            unsigned int Code_Point)
+{
+    window_event event = {};
+    event.type = window_event_type::eCharacter;
+    event.character = Code_Point;
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_character_event_callback
+    window_character_event_callback_config::CALL_EVENT_HANDLER =
+        (window_character_event_callback)[](GLFWwindow * Window_Handle,
+                                            unsigned int Code_Point)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.character) {
+        windowPtr->eventHandlers.character(*windowPtr, Code_Point);
+    }
 };
 
 const window_cursor_position_event_callback
@@ -335,8 +388,33 @@ const window_cursor_position_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->cursorPositionEventsMutex);
-    windowPtr->cursorPositionEvents.emplace_back(X_Position, Y_Position);
+    windowPtr->cursorPositionEvents.Push({ X_Position, Y_Position });
+};
+
+const window_cursor_position_event_callback
+    window_cursor_position_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_cursor_position_event_callback)[](GLFWwindow * Window_Handle,
+                                                  double X_Position,
+                                                  double Y_Position)
+{
+    window_event event = {};
+    event.type = window_event_type::eCursorPosition;
+    event.cursorPosition = { X_Position, Y_Position };
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_cursor_position_event_callback
+    window_cursor_position_event_callback_config::CALL_EVENT_HANDLER =
+        (window_cursor_position_event_callback)[](GLFWwindow * Window_Handle,
+                                                  double X_Position,
+                                                  double Y_Position)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.cursorPosition) {
+        windowPtr->eventHandlers.cursorPosition(*windowPtr,
+                                                { X_Position, Y_Position });
+    }
 };
 
 const window_cursor_enter_event_callback
@@ -349,8 +427,30 @@ const window_cursor_enter_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->cursorEnterEventsMutex);
-    windowPtr->cursorEnterEvents.emplace_back(Entered);
+    windowPtr->cursorEnterEvents.Push({ Entered });
+};
+
+const window_cursor_enter_event_callback
+    window_cursor_enter_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_cursor_enter_event_callback)[](GLFWwindow * Window_Handle,
+                                               int Entered)
+{
+    window_event event = {};
+    event.type = window_event_type::eCursorEnter;
+    event.cursorEnter = Entered;
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_cursor_enter_event_callback
+    window_cursor_enter_event_callback_config::CALL_EVENT_HANDLER =
+        (window_cursor_enter_event_callback)[](GLFWwindow * Window_Handle,
+                                               int Entered)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.cursorEnter) {
+        windowPtr->eventHandlers.cursorEnter(*windowPtr, Entered);
+    }
 };
 
 const window_mouse_button_event_callback
@@ -365,8 +465,35 @@ const window_mouse_button_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->mouseButtonEventsMutex);
-    windowPtr->mouseButtonEvents.emplace_back(Button, Action, Mods);
+    windowPtr->mouseButtonEvents.Push({ Button, Action, Mods });
+};
+
+const window_mouse_button_event_callback
+    window_mouse_button_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_mouse_button_event_callback)[](GLFWwindow * Window_Handle,
+                                               int Button,
+                                               int Action,
+                                               int Mods)
+{
+    window_event event = {};
+    event.type = window_event_type::eMouseButton;
+    event.mouseButton = { Button, Action, Mods };
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_mouse_button_event_callback
+    window_mouse_button_event_callback_config::CALL_EVENT_HANDLER =
+        (window_mouse_button_event_callback)[](GLFWwindow * Window_Handle,
+                                               int Button,
+                                               int Action,
+                                               int Mods)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.mouseButton) {
+        windowPtr->eventHandlers.mouseButton(*windowPtr,
+                                             { Button, Action, Mods });
+    }
 };
 
 const window_scroll_event_callback window_scroll_event_callback_config::NONE =
@@ -379,8 +506,32 @@ const window_scroll_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->scrollEventsMutex);
-    windowPtr->scrollEvents.emplace_back(X_Offset, Y_Offset);
+    windowPtr->scrollEvents.Push({ X_Offset, Y_Offset });
+};
+
+const window_scroll_event_callback
+    window_scroll_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_scroll_event_callback)[](GLFWwindow * Window_Handle,
+                                         double X_Offset,
+                                         double Y_Offset)
+{
+    window_event event = {};
+    event.type = window_event_type::eScroll;
+    event.scroll = { X_Offset, Y_Offset };
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_scroll_event_callback
+    window_scroll_event_callback_config::CALL_EVENT_HANDLER =
+        (window_scroll_event_callback)[](GLFWwindow * Window_Handle,
+                                         double X_Offset,
+                                         double Y_Offset)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.scroll) {
+        windowPtr->eventHandlers.scroll(*windowPtr, { X_Offset, Y_Offset });
+    }
 };
 
 const window_file_drop_event_callback
@@ -391,10 +542,25 @@ const window_file_drop_event_callback
                                             int Count,
                                             const char** Paths)
 {
-    auto* windowPtr =
-        static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->fileDropEventsMutex);
-    windowPtr->fileDropEvents.emplace_back(Count, Paths);
+    internal::AppendToFileDropEventBuffer(Window_Handle, Count, Paths);
+};
+
+const window_file_drop_event_callback
+    window_file_drop_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_file_drop_event_callback)[](GLFWwindow * Window_Handle,
+                                            int Count,
+                                            const char** Paths)
+{
+    internal::AppendFileDropToEventQueue(Window_Handle, Count, Paths);
+};
+
+const window_file_drop_event_callback
+    window_file_drop_event_callback_config::CALL_EVENT_HANDLER =
+        (window_file_drop_event_callback)[](GLFWwindow * Window_Handle,
+                                            int Count,
+                                            const char** Paths)
+{
+    internal::CallFileDropEventHandler(Window_Handle, Count, Paths);
 };
 
 const window_close_event_callback window_close_event_callback_config::NONE =
@@ -405,10 +571,29 @@ const window_close_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->closeEventsMutex);
     windowPtr->closeEvents++;
 };
 
+const window_close_event_callback
+    window_close_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_close_event_callback)[](GLFWwindow * Window_Handle)
+{
+    window_event event = {};
+    event.type = window_event_type::eClose;
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_close_event_callback
+    window_close_event_callback_config::CALL_EVENT_HANDLER =
+        (window_close_event_callback)[](GLFWwindow * Window_Handle)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.close) {
+        windowPtr->eventHandlers.close(*windowPtr);
+    }
+};
+
 const window_size_event_callback window_size_event_callback_config::NONE =
     nullptr;
 const window_size_event_callback
@@ -419,8 +604,32 @@ const window_size_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->sizeEventsMutex);
-    windowPtr->sizeEvents.emplace_back(Width, Height);
+    windowPtr->sizeEvents.Push({ Width, Height });
+};
+
+const window_size_event_callback
+    window_size_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_size_event_callback)[](GLFWwindow * Window_Handle,
+                                       int Width,
+                                       int Height)
+{
+    window_event event = {};
+    event.type = window_event_type::eSize;
+    event.size = { Width, Height };
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_size_event_callback
+    window_size_event_callback_config::CALL_EVENT_HANDLER =
+        (window_size_event_callback)[](GLFWwindow * Window_Handle,
+                                       int Width,
+                                       int Height)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.size) {
+        windowPtr->eventHandlers.size(*windowPtr, { Width, Height });
+    }
 };
 
 const window_framebuffer_size_event_callback
@@ -435,8 +644,32 @@ const window_framebuffer_size_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->framebufferSizeEventsMutex);
-    windowPtr->framebufferSizeEvents.emplace_back(Width, Height);
+    windowPtr->framebufferSizeEvents.Push({ Width, Height });
+};
+
+const window_framebuffer_size_event_callback
+    window_framebuffer_size_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_framebuffer_size_event_callback)[](GLFWwindow * Window_Handle,
+                                                   int Width,
+                                                   int Height)
+{
+    window_event event = {};
+    event.type = window_event_type::eFramebufferSize;
+    event.framebufferSize = { Width, Height };
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_framebuffer_size_event_callback
+    window_framebuffer_size_event_callback_config::CALL_EVENT_HANDLER =
+        (window_framebuffer_size_event_callback)[](GLFWwindow * Window_Handle,
+                                                   int Width,
+                                                   int Height)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.framebufferSize) {
+        windowPtr->eventHandlers.framebufferSize(*windowPtr, { Width, Height });
+    }
 };
 
 const window_content_scale_event_callback
@@ -450,8 +683,32 @@ const window_content_scale_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->contentScaleEventsMutex);
-    windowPtr->contentScaleEvents.emplace_back(X_Scale, Y_Scale);
+    windowPtr->contentScaleEvents.Push({ X_Scale, Y_Scale });
+};
+
+const window_content_scale_event_callback
+    window_content_scale_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_content_scale_event_callback)[](GLFWwindow * Window_Handle,
+                                                float X_Scale,
+                                                float Y_Scale)
+{
+    window_event event = {};
+    event.type = window_event_type::eContentScale;
+    event.contentScale = { X_Scale, Y_Scale };
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_content_scale_event_callback
+    window_content_scale_event_callback_config::CALL_EVENT_HANDLER =
+        (window_content_scale_event_callback)[](GLFWwindow * Window_Handle,
+                                                float X_Scale,
+                                                float Y_Scale)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.contentScale) {
+        windowPtr->eventHandlers.contentScale(*windowPtr, { X_Scale, Y_Scale });
+    }
 };
 
 const window_position_event_callback
@@ -464,8 +721,33 @@ const window_position_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->positionEventsMutex);
-    windowPtr->positionEvents.emplace_back(X_Position, Y_Position);
+    windowPtr->positionEvents.Push({ X_Position, Y_Position });
+};
+
+const window_position_event_callback
+    window_position_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_position_event_callback)[](GLFWwindow * Window_Handle,
+                                           int X_Position,
+                                           int Y_Position)
+{
+    window_event event = {};
+    event.type = window_event_type::ePosition;
+    event.position = { X_Position, Y_Position };
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_position_event_callback
+    window_position_event_callback_config::CALL_EVENT_HANDLER =
+        (window_position_event_callback)[](GLFWwindow * Window_Handle,
+                                           int X_Position,
+                                           int Y_Position)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.position) {
+        windowPtr->eventHandlers.position(*windowPtr,
+                                          { X_Position, Y_Position });
+    }
 };
 
 const window_iconify_event_callback window_iconify_event_callback_config::NONE =
@@ -477,8 +759,30 @@ const window_iconify_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->iconifyEventsMutex);
-    windowPtr->iconifyEvents.emplace_back(Iconified);
+    windowPtr->iconifyEvents.Push({ Iconified });
+};
+
+const window_iconify_event_callback
+    window_iconify_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_iconify_event_callback)[](GLFWwindow * Window_Handle,
+                                          int Iconified)
+{
+    window_event event = {};
+    event.type = window_event_type::eIconify;
+    event.iconify = Iconified;
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_iconify_event_callback
+    window_iconify_event_callback_config::CALL_EVENT_HANDLER =
+        (window_iconify_event_callback)[](GLFWwindow * Window_Handle,
+                                          int Iconified)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.iconify) {
+        windowPtr->eventHandlers.iconify(*windowPtr, Iconified);
+    }
 };
 
 const window_maximize_event_callback
@@ -490,8 +794,30 @@ const window_maximize_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->maximizeEventsMutex);
-    windowPtr->maximizeEvents.emplace_back(Maximized);
+    windowPtr->maximizeEvents.Push({ Maximized });
+};
+
+const window_maximize_event_callback
+    window_maximize_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_maximize_event_callback)[](GLFWwindow * Window_Handle,
+                                           int Maximized)
+{
+    window_event event = {};
+    event.type = window_event_type::eMaximize;
+    event.maximize = Maximized;
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_maximize_event_callback
+    window_maximize_event_callback_config::CALL_EVENT_HANDLER =
+        (window_maximize_event_callback)[](GLFWwindow * Window_Handle,
+                                           int Maximized)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.maximize) {
+        windowPtr->eventHandlers.maximize(*windowPtr, Maximized);
+    }
 };
 
 const window_focus_event_callback window_focus_event_callback_config::NONE =
@@ -502,8 +828,28 @@ const window_focus_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->focusEventsMutex);
-    windowPtr->focusEvents.emplace_back(Focused);
+    windowPtr->focusEvents.Push({ Focused });
+};
+
+const window_focus_event_callback
+    window_focus_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_focus_event_callback)[](GLFWwindow * Window_Handle, int Focused)
+{
+    window_event event = {};
+    event.type = window_event_type::eFocus;
+    event.focus = Focused;
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_focus_event_callback
+    window_focus_event_callback_config::CALL_EVENT_HANDLER =
+        (window_focus_event_callback)[](GLFWwindow * Window_Handle, int Focused)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.focus) {
+        windowPtr->eventHandlers.focus(*windowPtr, Focused);
+    }
 };
 
 const window_refresh_event_callback window_refresh_event_callback_config::NONE =
@@ -514,10 +860,29 @@ const window_refresh_event_callback
 {
     auto* windowPtr =
         static_cast<window*>(internal::GetUserPointer(Window_Handle));
-    std::scoped_lock lock(windowPtr->refreshEventsMutex);
     windowPtr->refreshEvents++;
 };
 
+const window_refresh_event_callback
+    window_refresh_event_callback_config::APPEND_TO_EVENT_QUEUE =
+        (window_refresh_event_callback)[](GLFWwindow * Window_Handle)
+{
+    window_event event = {};
+    event.type = window_event_type::eRefresh;
+    internal::AppendToEventQueue(Window_Handle, event);
+};
+
+const window_refresh_event_callback
+    window_refresh_event_callback_config::CALL_EVENT_HANDLER =
+        (window_refresh_event_callback)[](GLFWwindow * Window_Handle)
+{
+    auto* windowPtr =
+        static_cast<window*>(internal::GetUserPointer(Window_Handle));
+    if (windowPtr->eventHandlers.refresh) {
+        windowPtr->eventHandlers.refresh(*windowPtr);
+    }
+};
+
 const window_event_callbacks window_event_callbacks_config::NONE;
 const window_event_callbacks
     window_event_callbacks_config::APPEND_TO_EVENT_BUFFERS = {
@@ -556,6 +921,76 @@ const window_event_callbacks
             window_refresh_event_callback_config::APPEND_TO_REFRESH_EVENT_BUFFER
     };
 
+const window_event_callbacks
+    window_event_callbacks_config::APPEND_TO_EVENT_QUEUE = {
+        .keyCallback = window_key_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .characterCallback =
+            window_character_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .cursorPositionCallback =
+            window_cursor_position_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .cursorEnterCallback =
+            window_cursor_enter_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .mouseButtonCallback =
+            window_mouse_button_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .scrollCallback =
+            window_scroll_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .fileDropCallback =
+            window_file_drop_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .closeCallback =
+            window_close_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .sizeCallback =
+            window_size_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .framebufferSizeCallback =
+            window_framebuffer_size_event_callback_config::
+                APPEND_TO_EVENT_QUEUE,
+        .contentScaleCallback =
+            window_content_scale_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .positionCallback =
+            window_position_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .iconifyCallback =
+            window_iconify_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .maximizeCallback =
+            window_maximize_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .focusCallback =
+            window_focus_event_callback_config::APPEND_TO_EVENT_QUEUE,
+        .refreshCallback =
+            window_refresh_event_callback_config::APPEND_TO_EVENT_QUEUE
+    };
+
+const window_event_callbacks
+    window_event_callbacks_config::CALL_EVENT_HANDLERS = {
+        .keyCallback = window_key_event_callback_config::CALL_EVENT_HANDLER,
+        .characterCallback =
+            window_character_event_callback_config::CALL_EVENT_HANDLER,
+        .cursorPositionCallback =
+            window_cursor_position_event_callback_config::CALL_EVENT_HANDLER,
+        .cursorEnterCallback =
+            window_cursor_enter_event_callback_config::CALL_EVENT_HANDLER,
+        .mouseButtonCallback =
+            window_mouse_button_event_callback_config::CALL_EVENT_HANDLER,
+        .scrollCallback =
+            window_scroll_event_callback_config::CALL_EVENT_HANDLER,
+        .fileDropCallback =
+            window_file_drop_event_callback_config::CALL_EVENT_HANDLER,
+        .closeCallback = window_close_event_callback_config::CALL_EVENT_HANDLER,
+        .sizeCallback = window_size_event_callback_config::CALL_EVENT_HANDLER,
+        .framebufferSizeCallback =
+            window_framebuffer_size_event_callback_config::CALL_EVENT_HANDLER,
+        .contentScaleCallback =
+            window_content_scale_event_callback_config::CALL_EVENT_HANDLER,
+        .positionCallback =
+            window_position_event_callback_config::CALL_EVENT_HANDLER,
+        .iconifyCallback =
+            window_iconify_event_callback_config::CALL_EVENT_HANDLER,
+        .maximizeCallback =
+            window_maximize_event_callback_config::CALL_EVENT_HANDLER,
+        .focusCallback = window_focus_event_callback_config::CALL_EVENT_HANDLER,
+        .refreshCallback =
+            window_refresh_event_callback_config::CALL_EVENT_HANDLER
+    };
+
+const window_event_buffers_info window_event_buffers_info_config::DEFAULT;
+
 const window_creation_hints_info window_creation_hints_info_config::DEFAULT;
 
 const window_creation_hints window_creation_hints_config::DEFAULT;
@@ -583,13 +1018,25 @@ const cursor_custom_shape_info cursor_custom_shape_info_config::DEFAULT;
 /********************************    Shader    ********************************/
 const shader_info shader_info_config::DEFAULT;
 
+const shader_specialization_constants
+    shader_specialization_constants_config::NONE;
+
 const vertex_shader_info vertex_shader_info_config::DEFAULT;
 
 const fragment_shader_info fragment_shader_info_config::DEFAULT;
 
+const compute_shader_info compute_shader_info_config::DEFAULT;
+
 /********************************    Buffer    ********************************/
 const buffer_info buffer_info_config::DEFAULT;
 
+const buffer_ring_info buffer_ring_info_config::UNIFORM = {
+    .usage = vk::BufferUsageFlagBits::eUniformBuffer
+};
+const buffer_ring_info buffer_ring_info_config::STORAGE = {
+    .usage = vk::BufferUsageFlagBits::eStorageBuffer
+};
+
 /******************************    Render Pass    *****************************/
 const render_pass_info render_pass_info_config::DEFAULT;
 
@@ -624,6 +1071,15 @@ const swapchain_present_modes
 
 const swapchain_info swapchain_info_config::DEFAULT;
 
+/******************************    Descriptor    ******************************/
+const descriptor_set_layout_bindings
+    descriptor_set_layout_bindings_config::NONE;
+
+const descriptor_set_layout_binding_flags
+    descriptor_set_layout_binding_flags_config::NONE;
+
+const descriptor_set_layout_info descriptor_set_layout_info_config::DEFAULT;
+
 /*******************************    Pipeline    *******************************/
 const pipeline_shaders pipeline_shaders_config::NONE;
 
@@ -636,8 +1092,40 @@ const pipeline_dynamic_states
         vk::DynamicState::eScissor
     };
 
+const pipeline_push_constant_ranges pipeline_push_constant_ranges_config::NONE;
+
+const pipeline_descriptor_set_layouts
+    pipeline_descriptor_set_layouts_config::NONE;
+
+const pipeline_color_blend pipeline_color_blend_config::DISABLED = {
+    .blendEnable = VK_FALSE,
+    .srcColorBlendFactor = vk::BlendFactor::eOne,
+    .dstColorBlendFactor = vk::BlendFactor::eZero,
+    .colorBlendOp = vk::BlendOp::eAdd,
+    .srcAlphaBlendFactor = vk::BlendFactor::eOne,
+    .dstAlphaBlendFactor = vk::BlendFactor::eZero,
+    .alphaBlendOp = vk::BlendOp::eAdd,
+    .colorWriteMask =
+        vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG |
+        vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA
+};
+const pipeline_color_blend pipeline_color_blend_config::ALPHA = {
+    .blendEnable = VK_TRUE,
+    .srcColorBlendFactor = vk::BlendFactor::eSrcAlpha,
+    .dstColorBlendFactor = vk::BlendFactor::eOneMinusSrcAlpha,
+    .colorBlendOp = vk::BlendOp::eAdd,
+    .srcAlphaBlendFactor = vk::BlendFactor::eOne,
+    .dstAlphaBlendFactor = vk::BlendFactor::eOneMinusSrcAlpha,
+    .alphaBlendOp = vk::BlendOp::eAdd,
+    .colorWriteMask =
+        vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG |
+        vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA
+};
+
 const pipeline_info pipeline_info_config::DEFAULT;
 
+const compute_pipeline_info compute_pipeline_info_config::DEFAULT;
+
 /********************************    Device    ********************************/
 const device_selection_function device_selection_function_config::NONE =
     nullptr;
@@ -863,6 +1351,21 @@ const device_selection_function
 };
 
 const device_features device_features_config::NONE;
+const device_features device_features_config::MULTI_DRAW_INDIRECT = {
+    .multiDrawIndirect = VK_TRUE,
+    .drawIndirectFirstInstance = VK_TRUE
+};
+
+const device_vulkan12_features device_vulkan12_features_config::NONE;
+const device_vulkan12_features
+    device_vulkan12_features_config::DRAW_INDIRECT_COUNT = {
+        .drawIndirectCount = VK_TRUE
+    };
+
+const device_bindless_info device_bindless_info_config::DISABLED;
+const device_bindless_info device_bindless_info_config::ENABLED = {
+    .enable = true
+};
 
 const device_extensions device_extensions_config::NONE;
 const device_extensions device_extensions_config::SWAPCHAIN = {
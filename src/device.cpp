@@ -1,6 +1,8 @@
 // Standard includes
 #include <iostream>
 #include <fstream>
+#include <bit>
+#include <numeric>
 
 // Local includes
 #include "gvw.ipp"
@@ -8,6 +10,7 @@
 #include "window.hpp"
 #include "device.hpp"
 #include "impl.hpp"
+#include "shaders/mipmap.comp.hpp"
 
 namespace gvw {
 
@@ -17,6 +20,7 @@ device::device(const device_info& Device_Info)
     , surfaceFormat(Device_Info.surfaceFormat)
     , presentMode(Device_Info.presentMode)
     , queueFamilyInfos(Device_Info.queueFamilyInfos)
+    , bindlessInfo(Device_Info.bindless)
 {
     /// @todo GVW could be destroyed and then reinitialized between the
     /// initialization of gvwInstance and this line below. Resolve this by
@@ -49,7 +53,46 @@ device::device(const device_info& Device_Info)
             return Queue_Family_Info.createInfo;
         });
 
+    // Bindless resources require descriptor indexing with update-after-bind.
+    device_vulkan12_features vulkan12Features = Device_Info.vulkan12Features;
+    vulkan12Features.pNext = nullptr;
+    if (this->bindlessInfo.enable) {
+        vulkan12Features.descriptorIndexing = VK_TRUE;
+        vulkan12Features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+        vulkan12Features.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+        vulkan12Features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        vulkan12Features.descriptorBindingStorageBufferUpdateAfterBind =
+            VK_TRUE;
+        vulkan12Features.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+        vulkan12Features.descriptorBindingPartiallyBound = VK_TRUE;
+        vulkan12Features.runtimeDescriptorArray = VK_TRUE;
+    }
+
+    // Only chain Vulkan 1.2 features if any are requested.
+    bool chainVulkan12Features =
+        vulkan12Features != device_vulkan12_features_config::NONE;
+    if (chainVulkan12Features) {
+        if (this->physicalDevice.getProperties().apiVersion <
+            VK_API_VERSION_1_2) {
+            ErrorCallback("Vulkan 1.2 features were requested but the physical "
+                          "device does not support Vulkan 1.2.");
+            return;
+        }
+        vk::PhysicalDeviceVulkan12Features availableVulkan12Features =
+            this->physicalDevice
+                .getFeatures2<vk::PhysicalDeviceFeatures2,
+                              vk::PhysicalDeviceVulkan12Features>()
+                .get<vk::PhysicalDeviceVulkan12Features>();
+        if (!internal::Vulkan12FeaturesSupported(vulkan12Features,
+                                                 availableVulkan12Features)) {
+            ErrorCallback("The physical device does not support the requested "
+                          "Vulkan 1.2 features.");
+            return;
+        }
+    }
+
     vk::DeviceCreateInfo logicalDeviceCreateInfo = {
+        .pNext = chainVulkan12Features ? &vulkan12Features : nullptr,
         .queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size()),
         .pQueueCreateInfos = queueCreateInfos.data(),
         .enabledLayerCount = static_cast<uint32_t>(
@@ -62,6 +105,117 @@ device::device(const device_info& Device_Info)
         .pEnabledFeatures = &Device_Info.physicalDeviceFeatures
     };
     this->handle = physicalDevice.createDeviceUnique(logicalDeviceCreateInfo);
+    this->enabledFeatures = Device_Info.physicalDeviceFeatures;
+    this->enabledVulkan12Features = vulkan12Features;
+
+    this->pipelineCache = this->handle->createPipelineCacheUnique({});
+
+    for (const auto& queueFamilyInfo : this->queueFamilyInfos) {
+        for (uint32_t i = 0; i < queueFamilyInfo.createInfo.queueCount; ++i) {
+            this->queueMutexes.try_emplace(this->handle->getQueue(
+                queueFamilyInfo.createInfo.queueFamilyIndex, i));
+        }
+    }
+
+    auto graphicsQueueFamilyInfo = std::find_if(
+        this->queueFamilyInfos.begin(),
+        this->queueFamilyInfos.end(),
+        [](const device_selection_queue_family_info& Queue_Family_Info) {
+            return bool(Queue_Family_Info.properties.queueFlags &
+                        vk::QueueFlagBits::eGraphics);
+        });
+    if (graphicsQueueFamilyInfo != this->queueFamilyInfos.end()) {
+        uint32_t queueFamilyIndex =
+            graphicsQueueFamilyInfo->createInfo.queueFamilyIndex;
+        this->transferQueue = this->handle->getQueue(queueFamilyIndex, 0);
+        this->transferCommandPool = this->handle->createCommandPoolUnique(
+            { .flags = vk::CommandPoolCreateFlagBits::eTransient,
+              .queueFamilyIndex = queueFamilyIndex });
+    }
+
+    if (this->bindlessInfo.enable) {
+        this->CreateBindlessDescriptorSet();
+    }
+}
+
+void device::CreateBindlessDescriptorSet()
+{
+    // Clamp the array sizes to the update-after-bind limits of the device.
+    auto properties = this->physicalDevice.getProperties2<
+        vk::PhysicalDeviceProperties2,
+        vk::PhysicalDeviceVulkan12Properties>();
+    const auto& vulkan12Properties =
+        properties.get<vk::PhysicalDeviceVulkan12Properties>();
+    uint32_t maxSampledImages = std::min(
+        { this->bindlessInfo.maxSampledImages,
+          vulkan12Properties.maxDescriptorSetUpdateAfterBindSampledImages,
+          vulkan12Properties.maxDescriptorSetUpdateAfterBindSamplers,
+          vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+          vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSamplers });
+    uint32_t maxStorageBuffers = std::min(
+        { this->bindlessInfo.maxStorageBuffers,
+          vulkan12Properties.maxDescriptorSetUpdateAfterBindStorageBuffers,
+          vulkan12Properties
+              .maxPerStageDescriptorUpdateAfterBindStorageBuffers });
+    if (maxSampledImages < this->bindlessInfo.maxSampledImages ||
+        maxStorageBuffers < this->bindlessInfo.maxStorageBuffers) {
+        WarningCallback("The requested number of bindless descriptors exceeds "
+                        "the limits of the device and was reduced.");
+        this->bindlessInfo.maxSampledImages = maxSampledImages;
+        this->bindlessInfo.maxStorageBuffers = maxStorageBuffers;
+    }
+
+    descriptor_set_layout_bindings bindings = {
+        { .binding = 0,
+          .descriptorType = vk::DescriptorType::eCombinedImageSampler,
+          .descriptorCount = maxSampledImages,
+          .stageFlags = vk::ShaderStageFlagBits::eAll },
+        { .binding = 1,
+          .descriptorType = vk::DescriptorType::eStorageBuffer,
+          .descriptorCount = maxStorageBuffers,
+          .stageFlags = vk::ShaderStageFlagBits::eAll }
+    };
+    // Descriptors may be written while the set is bound and unused elements
+    // may be left unwritten.
+    vk::DescriptorBindingFlags bindingFlags =
+        vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+        vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending |
+        vk::DescriptorBindingFlagBits::ePartiallyBound;
+    this->bindlessDescriptorSetLayout = this->CreateDescriptorSetLayout(
+        { .bindings = bindings,
+          .bindingFlags = { bindingFlags, bindingFlags },
+          .flags =
+              vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool });
+
+    std::array<vk::DescriptorPoolSize, 2> poolSizes = {
+        { { .type = vk::DescriptorType::eCombinedImageSampler,
+            .descriptorCount = maxSampledImages },
+          { .type = vk::DescriptorType::eStorageBuffer,
+            .descriptorCount = maxStorageBuffers } }
+    };
+    vk::DescriptorPoolCreateInfo descriptorPoolCreateInfo = {
+        .flags = vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind,
+        .maxSets = 1,
+        .poolSizeCount = static_cast<uint32_t>(poolSizes.size()),
+        .pPoolSizes = poolSizes.data()
+    };
+    this->bindlessDescriptorPool =
+        this->handle->createDescriptorPoolUnique(descriptorPoolCreateInfo);
+
+    vk::DescriptorSetLayout descriptorSetLayout =
+        this->bindlessDescriptorSetLayout->handle.get();
+    vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo = {
+        .descriptorPool = this->bindlessDescriptorPool.get(),
+        .descriptorSetCount = 1,
+        .pSetLayouts = &descriptorSetLayout
+    };
+    this->bindlessDescriptorSet =
+        this->handle->allocateDescriptorSets(descriptorSetAllocateInfo).at(0);
+
+    this->bindlessSampledImageIndices =
+        internal::index_allocator(maxSampledImages);
+    this->bindlessStorageBufferIndices =
+        internal::index_allocator(maxStorageBuffers);
 }
 
 vk::Device device::GetHandle() const
@@ -79,6 +233,32 @@ vk::SurfaceFormatKHR device::GetSurfaceFormat() const
     return this->surfaceFormat;
 }
 
+std::mutex& device::GetQueueMutex(vk::Queue Queue)
+{
+    return this->queueMutexes.at(static_cast<VkQueue>(Queue));
+}
+
+void device::WaitIdle()
+{
+    // Waiting for the device accesses every queue.
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(this->queueMutexes.size());
+    for (auto& [queue, queueMutex] : this->queueMutexes) {
+        locks.emplace_back(queueMutex);
+    }
+    this->handle->waitIdle();
+}
+
+const device_features& device::GetEnabledFeatures() const
+{
+    return this->enabledFeatures;
+}
+
+const device_vulkan12_features& device::GetEnabledVulkan12Features() const
+{
+    return this->enabledVulkan12Features;
+}
+
 vk::PresentModeKHR device::GetPresentMode() const
 {
     return this->presentMode;
@@ -92,16 +272,38 @@ std::vector<device_selection_queue_family_info> device::GetQueueFamilyInfos()
 
 shader_ptr device::LoadShaderFromSpirVFile(const shader_info& Shader_Info)
 {
-    auto charBuffer = ReadFile(Shader_Info.code);
-
-    vk::ShaderModuleCreateInfo shaderModuleCreateInfo = {
-        .codeSize = charBuffer.size(),
-        .pCode = reinterpret_cast<const uint32_t*>(charBuffer.data()) // NOLINT
-    };
+    vk::ShaderModuleCreateInfo shaderModuleCreateInfo;
+    file_view_ptr spirvFile;
+    if (Shader_Info.spirv.empty()) {
+        // Map SPIR-V from a file. Mappings are page aligned, so the words are
+        // read in place.
+        spirvFile = MapFile(Shader_Info.code);
+        if (spirvFile == nullptr) {
+            return nullptr;
+        }
+        std::span<const std::byte> spirvBytes = spirvFile->GetData();
+        if (spirvBytes.empty() || spirvBytes.size() % sizeof(uint32_t) != 0) {
+            ErrorCallback(("\"" + static_cast<std::string>(Shader_Info.code) +
+                           "\" is not a SPIR-V binary.")
+                              .c_str());
+            return nullptr;
+        }
+        shaderModuleCreateInfo = {
+            .codeSize = spirvBytes.size(),
+            .pCode =
+                reinterpret_cast<const uint32_t*>(spirvBytes.data()) // NOLINT
+        };
+    } else {
+        // Use SPIR-V already present in memory.
+        shaderModuleCreateInfo = { .codeSize = Shader_Info.spirv.size_bytes(),
+                                   .pCode = Shader_Info.spirv.data() };
+    }
     return std::make_shared<internal::shader_public_constructor>(
         this->handle->createShaderModuleUnique(shaderModuleCreateInfo),
         Shader_Info.stage,
-        Shader_Info.entryPoint);
+        Shader_Info.entryPoint,
+        internal::CreateShaderSpecialization(
+            Shader_Info.specializationConstants));
 }
 
 vertex_shader_ptr device::LoadVertexShaderFromSpirVFile(
@@ -109,10 +311,14 @@ vertex_shader_ptr device::LoadVertexShaderFromSpirVFile(
 {
     shader_ptr genericShader =
         LoadShaderFromSpirVFile(Vertex_Shader_Info.general);
+    if (genericShader == nullptr) {
+        return nullptr;
+    }
     return std::make_shared<internal::vertex_shader_public_constructor>(
         std::move(genericShader->handle),
         genericShader->stage,
         genericShader->entryPoint,
+        std::move(genericShader->specialization),
         Vertex_Shader_Info.bindingDescriptions,
         Vertex_Shader_Info.attributeDescriptions);
 }
@@ -124,10 +330,85 @@ fragment_shader_ptr device::LoadFragmentShaderFromSpirVFile(
     shader_ptr genericShader =
         LoadShaderFromSpirVFile(Fragment_Shader_Info.general);
     // NOLINTEND
+    if (genericShader == nullptr) {
+        return nullptr;
+    }
     return std::make_shared<internal::fragment_shader_public_constructor>(
         std::move(genericShader->handle),
         genericShader->stage,
-        genericShader->entryPoint);
+        genericShader->entryPoint,
+        std::move(genericShader->specialization));
+}
+
+compute_shader_ptr device::LoadComputeShaderFromSpirVFile(
+    const compute_shader_info& Compute_Shader_Info)
+{
+    if (Compute_Shader_Info.general.stage !=
+        vk::ShaderStageFlagBits::eCompute) {
+        ErrorCallback("A compute shader must use the compute shader stage.");
+        return nullptr;
+    }
+    shader_ptr genericShader =
+        LoadShaderFromSpirVFile(Compute_Shader_Info.general);
+    if (genericShader == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<internal::compute_shader_public_constructor>(
+        std::move(genericShader->handle),
+        genericShader->stage,
+        genericShader->entryPoint,
+        std::move(genericShader->specialization));
+}
+
+std::optional<uint32_t> device::FindMemoryTypeIndex(
+    uint32_t Memory_Type_Bits,
+    vk::MemoryPropertyFlags Memory_Properties) const
+{
+    vk::PhysicalDeviceMemoryProperties memoryProperties =
+        this->physicalDevice.getMemoryProperties();
+
+    std::optional<uint32_t> memoryTypeIndex;
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i) {
+        if (((Memory_Type_Bits & (1 << i)) != 0U) &&
+            ((memoryProperties.memoryTypes.at(i).propertyFlags &
+              Memory_Properties) == Memory_Properties)) {
+            memoryTypeIndex = i;
+        }
+    }
+    return memoryTypeIndex;
+}
+
+void device::SubmitTransferCommands(
+    const std::function<void(vk::CommandBuffer)>& Record)
+{
+    std::scoped_lock lock(this->transferMutex);
+
+    vk::UniqueCommandBuffer commandBuffer = std::move(
+        this->handle
+            ->allocateCommandBuffersUnique(
+                { .commandPool = this->transferCommandPool.get(),
+                  .level = vk::CommandBufferLevel::ePrimary,
+                  .commandBufferCount = 1 })
+            .at(0));
+
+    commandBuffer->begin(
+        { .flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit });
+    Record(commandBuffer.get());
+    commandBuffer->end();
+
+    // Wait on a fence rather than the whole queue so that unrelated work is
+    // not waited on.
+    vk::UniqueFence fence = this->handle->createFenceUnique({});
+    vk::SubmitInfo submitInfo = { .commandBufferCount = 1,
+                                  .pCommandBuffers = &commandBuffer.get() };
+    {
+        std::scoped_lock queueLock(this->GetQueueMutex(this->transferQueue));
+        this->transferQueue.submit(submitInfo, fence.get());
+    }
+    if (this->handle->waitForFences(fence.get(), VK_TRUE, UINT64_MAX) !=
+        vk::Result::eSuccess) {
+        ErrorCallback("Failed to wait for a transfer to complete.");
+    }
 }
 
 buffer_ptr device::CreateBuffer(const buffer_info& Buffer_Info)
@@ -135,7 +416,8 @@ buffer_ptr device::CreateBuffer(const buffer_info& Buffer_Info)
     buffer_ptr buffer = std::make_shared<internal::buffer_public_constructor>(
         Buffer_Info.sizeInBytes,
         vk::UniqueBuffer(nullptr),
-        vk::UniqueDeviceMemory(nullptr));
+        vk::UniqueDeviceMemory(nullptr),
+        Buffer_Info.memoryProperties);
 
     vk::BufferCreateInfo bufferCreateInfo = {
         .size = buffer->size,
@@ -148,21 +430,12 @@ buffer_ptr device::CreateBuffer(const buffer_info& Buffer_Info)
     vk::MemoryRequirements memoryRequirements =
         this->handle->getBufferMemoryRequirements(buffer->handle.get());
 
-    vk::PhysicalDeviceMemoryProperties memoryProperties =
-        this->physicalDevice.getMemoryProperties();
-
-    std::optional<uint32_t> memoryTypeIndex;
-    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i) {
-        if (((memoryRequirements.memoryTypeBits & (1 << i)) != 0U) &&
-            ((memoryProperties.memoryTypes.at(i).propertyFlags &
-              Buffer_Info.memoryProperties) == Buffer_Info.memoryProperties)) {
-            memoryTypeIndex = i;
-        }
-    }
-
+    std::optional<uint32_t> memoryTypeIndex = this->FindMemoryTypeIndex(
+        memoryRequirements.memoryTypeBits, Buffer_Info.memoryProperties);
     if (memoryTypeIndex.has_value() == false) {
         ErrorCallback(
             "Failed to find a viable memory type for a Vulkan buffer.");
+        return nullptr;
     }
 
     vk::MemoryAllocateInfo memoryAllocateInfo = { .allocationSize =
@@ -177,6 +450,1075 @@ buffer_ptr device::CreateBuffer(const buffer_info& Buffer_Info)
     return buffer;
 }
 
+void device::WriteBuffer(const buffer_ptr& Buffer,
+                         std::span<const std::byte> Data,
+                         vk::DeviceSize Offset)
+{
+    if (!(Buffer->memoryProperties &
+          vk::MemoryPropertyFlagBits::eHostVisible)) {
+        ErrorCallback("Cannot write to a buffer that is not host visible.");
+        return;
+    }
+    if (Offset + Data.size() > Buffer->size) {
+        ErrorCallback("Cannot write past the end of a buffer.");
+        return;
+    }
+
+    // Memory that is already mapped must not be mapped again. Otherwise, map
+    // the whole allocation so that flushed ranges are always aligned to the
+    // non-coherent atom size.
+    bool persistentlyMapped = Buffer->persistentMapping != nullptr;
+    auto* mappedMemory = static_cast<std::byte*>(
+        persistentlyMapped ? Buffer->persistentMapping
+                           : this->handle->mapMemory(
+                                 Buffer->memory.get(), 0, VK_WHOLE_SIZE, {}));
+    std::memcpy(mappedMemory + Offset, Data.data(), Data.size());
+    if (!(Buffer->memoryProperties &
+          vk::MemoryPropertyFlagBits::eHostCoherent)) {
+        this->handle->flushMappedMemoryRanges(
+            vk::MappedMemoryRange{ .memory = Buffer->memory.get(),
+                                   .offset = 0,
+                                   .size = VK_WHOLE_SIZE });
+    }
+    if (!persistentlyMapped) {
+        this->handle->unmapMemory(Buffer->memory.get());
+    }
+}
+
+bool device::ComputeMipmapsSupported(vk::Format Format) const
+{
+    if (Format != vk::Format::eR8G8B8A8Unorm &&
+        Format != vk::Format::eR8G8B8A8Srgb) {
+        return false;
+    }
+    // sRGB images are created with the extended usage flag (Vulkan 1.1) so
+    // that storage usage is only checked against the UNORM view.
+    if (Format == vk::Format::eR8G8B8A8Srgb &&
+        this->physicalDevice.getProperties().apiVersion < VK_API_VERSION_1_1) {
+        return false;
+    }
+    // Mip levels are written through a UNORM view.
+    return bool(
+        this->physicalDevice.getFormatProperties(vk::Format::eR8G8B8A8Unorm)
+            .optimalTilingFeatures &
+        vk::FormatFeatureFlagBits::eStorageImage);
+}
+
+pipeline_ptr device::GetMipmapPipeline()
+{
+    std::scoped_lock lock(this->mipmapMutex);
+    if (this->mipmapPipeline != nullptr) {
+        return this->mipmapPipeline;
+    }
+
+    descriptor_set_layout_bindings bindings = {
+        { .binding = 0,
+          .descriptorType = vk::DescriptorType::eCombinedImageSampler,
+          .descriptorCount = 1,
+          .stageFlags = vk::ShaderStageFlagBits::eCompute },
+        { .binding = 1,
+          .descriptorType = vk::DescriptorType::eStorageImage,
+          .descriptorCount = 1,
+          .stageFlags = vk::ShaderStageFlagBits::eCompute }
+    };
+    this->mipmapDescriptorSetLayout =
+        this->CreateDescriptorSetLayout({ .bindings = bindings });
+
+    compute_shader_ptr mipmapShader = this->LoadComputeShaderFromSpirVFile(
+        { .general = { .name = "mipmap.comp",
+                       .spirv = internal::MIPMAP_COMPUTE_SHADER_SPIRV,
+                       .stage = vk::ShaderStageFlagBits::eCompute } });
+
+    // The destination size and an sRGB flag.
+    pipeline_push_constant_ranges pushConstantRanges = {
+        { .stageFlags = vk::ShaderStageFlagBits::eCompute,
+          .offset = 0,
+          .size = 3 * sizeof(uint32_t) }
+    };
+    pipeline_descriptor_set_layouts descriptorSetLayouts = {
+        this->mipmapDescriptorSetLayout
+    };
+    this->mipmapPipeline = this->CreateComputePipeline(
+        { .shader = mipmapShader,
+          .pushConstantRanges = pushConstantRanges,
+          .descriptorSetLayouts = descriptorSetLayouts });
+
+    // Texels are fetched directly, so the sampler never filters.
+    this->mipmapSampler = this->handle->createSamplerUnique(
+        { .magFilter = vk::Filter::eNearest,
+          .minFilter = vk::Filter::eNearest,
+          .mipmapMode = vk::SamplerMipmapMode::eNearest,
+          .addressModeU = vk::SamplerAddressMode::eClampToEdge,
+          .addressModeV = vk::SamplerAddressMode::eClampToEdge,
+          .addressModeW = vk::SamplerAddressMode::eClampToEdge });
+
+    return this->mipmapPipeline;
+}
+
+void device::RecordMipmapBlits(vk::CommandBuffer Command_Buffer,
+                               const texture& Texture)
+{
+    auto width = static_cast<int32_t>(Texture.extent.width);
+    auto height = static_cast<int32_t>(Texture.extent.height);
+    for (uint32_t level = 1; level < Texture.mipLevels; ++level) {
+        internal::RecordImageLayoutTransition(
+            Command_Buffer,
+            Texture.handle.get(),
+            level - 1,
+            1,
+            vk::ImageLayout::eTransferDstOptimal,
+            vk::ImageLayout::eTransferSrcOptimal,
+            vk::AccessFlagBits::eTransferWrite,
+            vk::AccessFlagBits::eTransferRead,
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::PipelineStageFlagBits::eTransfer);
+
+        int32_t nextWidth = std::max(width / 2, 1);
+        int32_t nextHeight = std::max(height / 2, 1);
+        Command_Buffer.blitImage(
+            Texture.handle.get(),
+            vk::ImageLayout::eTransferSrcOptimal,
+            Texture.handle.get(),
+            vk::ImageLayout::eTransferDstOptimal,
+            vk::ImageBlit{
+                .srcSubresource = { .aspectMask =
+                                        vk::ImageAspectFlagBits::eColor,
+                                    .mipLevel = level - 1,
+                                    .baseArrayLayer = 0,
+                                    .layerCount = 1 },
+                .srcOffsets = std::array<vk::Offset3D, 2>{
+                    vk::Offset3D{ 0, 0, 0 }, vk::Offset3D{ width, height, 1 } },
+                .dstSubresource = { .aspectMask =
+                                        vk::ImageAspectFlagBits::eColor,
+                                    .mipLevel = level,
+                                    .baseArrayLayer = 0,
+                                    .layerCount = 1 },
+                .dstOffsets = std::array<vk::Offset3D, 2>{
+                    vk::Offset3D{ 0, 0, 0 },
+                    vk::Offset3D{ nextWidth, nextHeight, 1 } } },
+            vk::Filter::eLinear);
+
+        internal::RecordImageLayoutTransition(
+            Command_Buffer,
+            Texture.handle.get(),
+            level - 1,
+            1,
+            vk::ImageLayout::eTransferSrcOptimal,
+            vk::ImageLayout::eShaderReadOnlyOptimal,
+            vk::AccessFlagBits::eTransferRead,
+            vk::AccessFlagBits::eShaderRead,
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::PipelineStageFlagBits::eFragmentShader |
+                vk::PipelineStageFlagBits::eComputeShader);
+
+        width = nextWidth;
+        height = nextHeight;
+    }
+
+    internal::RecordImageLayoutTransition(
+        Command_Buffer,
+        Texture.handle.get(),
+        Texture.mipLevels - 1,
+        1,
+        vk::ImageLayout::eTransferDstOptimal,
+        vk::ImageLayout::eShaderReadOnlyOptimal,
+        vk::AccessFlagBits::eTransferWrite,
+        vk::AccessFlagBits::eShaderRead,
+        vk::PipelineStageFlagBits::eTransfer,
+        vk::PipelineStageFlagBits::eFragmentShader |
+            vk::PipelineStageFlagBits::eComputeShader);
+}
+
+void device::RecordMipmapDispatches(
+    vk::CommandBuffer Command_Buffer,
+    const texture& Texture,
+    const std::vector<vk::DescriptorSet>& Descriptor_Sets)
+{
+    // Level 0 is sampled and the remaining levels are written as storage
+    // images.
+    internal::RecordImageLayoutTransition(
+        Command_Buffer,
+        Texture.handle.get(),
+        0,
+        1,
+        vk::ImageLayout::eTransferDstOptimal,
+        vk::ImageLayout::eShaderReadOnlyOptimal,
+        vk::AccessFlagBits::eTransferWrite,
+        vk::AccessFlagBits::eShaderRead,
+        vk::PipelineStageFlagBits::eTransfer,
+        vk::PipelineStageFlagBits::eComputeShader);
+    internal::RecordImageLayoutTransition(
+        Command_Buffer,
+        Texture.handle.get(),
+        1,
+        Texture.mipLevels - 1,
+        vk::ImageLayout::eUndefined,
+        vk::ImageLayout::eGeneral,
+        {},
+        vk::AccessFlagBits::eShaderWrite,
+        vk::PipelineStageFlagBits::eTopOfPipe,
+        vk::PipelineStageFlagBits::eComputeShader);
+
+    Command_Buffer.bindPipeline(vk::PipelineBindPoint::eCompute,
+                                this->mipmapPipeline->handle.get());
+
+    uint32_t srgb = (Texture.format == vk::Format::eR8G8B8A8Srgb) ? 1 : 0;
+    uint32_t width = Texture.extent.width;
+    uint32_t height = Texture.extent.height;
+    for (uint32_t level = 1; level < Texture.mipLevels; ++level) {
+        width = std::max(width / 2, 1U);
+        height = std::max(height / 2, 1U);
+
+        Command_Buffer.bindDescriptorSets(vk::PipelineBindPoint::eCompute,
+                                          this->mipmapPipeline->layout.get(),
+                                          0,
+                                          Descriptor_Sets.at(level - 1),
+                                          {});
+        std::array<uint32_t, 3> pushConstants = { width, height, srgb };
+        Command_Buffer.pushConstants(this->mipmapPipeline->layout.get(),
+                                     vk::ShaderStageFlagBits::eCompute,
+                                     0,
+                                     sizeof(pushConstants),
+                                     pushConstants.data());
+        // The shader runs in groups of 8x8 invocations.
+        Command_Buffer.dispatch((width + 7) / 8, (height + 7) / 8, 1); // NOLINT
+
+        internal::RecordImageLayoutTransition(
+            Command_Buffer,
+            Texture.handle.get(),
+            level,
+            1,
+            vk::ImageLayout::eGeneral,
+            vk::ImageLayout::eShaderReadOnlyOptimal,
+            vk::AccessFlagBits::eShaderWrite,
+            vk::AccessFlagBits::eShaderRead,
+            vk::PipelineStageFlagBits::eComputeShader,
+            vk::PipelineStageFlagBits::eFragmentShader |
+                vk::PipelineStageFlagBits::eComputeShader);
+    }
+}
+
+texture_ptr device::UploadTexture(std::span<const std::byte> Pixels,
+                                  vk::Extent2D Extent,
+                                  const texture_info& Texture_Info)
+{
+    if (!this->transferCommandPool) {
+        ErrorCallback("Cannot create a texture on a device without a graphics "
+                      "queue.");
+        return nullptr;
+    }
+    if (Pixels.size_bytes() !=
+        static_cast<size_t>(Extent.width) * Extent.height * 4) {
+        ErrorCallback("Texture pixels must have four bytes per pixel.");
+        return nullptr;
+    }
+    vk::FormatFeatureFlags formatFeatures =
+        this->physicalDevice.getFormatProperties(Texture_Info.format)
+            .optimalTilingFeatures;
+    if (!(formatFeatures & vk::FormatFeatureFlagBits::eSampledImage)) {
+        ErrorCallback("The texture format cannot be sampled on this device.");
+        return nullptr;
+    }
+
+    texture_ptr texture =
+        std::make_shared<internal::texture_public_constructor>();
+    texture->extent = Extent;
+    texture->format = Texture_Info.format;
+
+    // Prefer linear blits for mipmaps and fall back to a compute shader.
+    bool blitMipmaps = false;
+    bool computeMipmaps = false;
+    if (Texture_Info.generateMipmaps) {
+        texture->mipLevels = static_cast<uint32_t>(std::bit_width(
+            std::max(texture->extent.width, texture->extent.height)));
+        const vk::FormatFeatureFlags blitFeatures =
+            vk::FormatFeatureFlagBits::eBlitSrc |
+            vk::FormatFeatureFlagBits::eBlitDst |
+            vk::FormatFeatureFlagBits::eSampledImageFilterLinear;
+        if ((formatFeatures & blitFeatures) == blitFeatures) {
+            blitMipmaps = true;
+        } else if (this->ComputeMipmapsSupported(texture->format)) {
+            computeMipmaps = true;
+        } else {
+            WarningCallback("Mipmaps cannot be generated for the texture "
+                            "format on this device.");
+            texture->mipLevels = 1;
+        }
+        if (texture->mipLevels == 1) {
+            blitMipmaps = false;
+            computeMipmaps = false;
+        }
+    }
+
+    // Convert the pixels to the texture format while copying them into a
+    // staging buffer. Mapped memory may be uncached, so every conversion reads
+    // from host memory.
+    buffer_ptr stagingBuffer = this->CreateBuffer(
+        { .sizeInBytes = Pixels.size_bytes(),
+          .usage = vk::BufferUsageFlagBits::eTransferSrc,
+          .memoryProperties = vk::MemoryPropertyFlagBits::eHostVisible |
+                              vk::MemoryPropertyFlagBits::eHostCoherent });
+    if (stagingBuffer == nullptr) {
+        return nullptr;
+    }
+    const bool swizzle = (texture->format == vk::Format::eB8G8R8A8Unorm ||
+                          texture->format == vk::Format::eB8G8R8A8Srgb);
+    const bool srgb = (texture->format == vk::Format::eR8G8B8A8Srgb ||
+                       texture->format == vk::Format::eB8G8R8A8Srgb);
+    std::span<const uint8_t> pixels = {
+        reinterpret_cast<const uint8_t*>(Pixels.data()), Pixels.size_bytes()
+    };
+    std::span<uint8_t> stagingPixels = {
+        static_cast<uint8_t*>(this->handle->mapMemory(
+            stagingBuffer->memory.get(), 0, VK_WHOLE_SIZE, {})),
+        Pixels.size_bytes()
+    };
+    std::vector<uint8_t> premultipliedPixels;
+    if (Texture_Info.premultiplyAlpha) {
+        std::span<uint8_t> premultiplied = stagingPixels;
+        if (swizzle) {
+            premultipliedPixels.resize(pixels.size());
+            premultiplied = premultipliedPixels;
+        }
+        if (srgb) {
+            internal::PremultiplyAlphaSrgb(pixels, premultiplied);
+        } else {
+            internal::PremultiplyAlpha(pixels, premultiplied);
+        }
+        pixels = premultiplied;
+    }
+    if (swizzle) {
+        internal::SwizzleRgbaToBgra(pixels, stagingPixels);
+    } else if (!Texture_Info.premultiplyAlpha) {
+        std::memcpy(stagingPixels.data(), pixels.data(), pixels.size());
+    }
+    this->handle->unmapMemory(stagingBuffer->memory.get());
+
+    vk::ImageCreateFlags imageCreateFlags = {};
+    vk::ImageUsageFlags imageUsage = vk::ImageUsageFlagBits::eTransferDst |
+                                     vk::ImageUsageFlagBits::eSampled;
+    if (blitMipmaps) {
+        imageUsage |= vk::ImageUsageFlagBits::eTransferSrc;
+    }
+    if (computeMipmaps) {
+        imageUsage |= vk::ImageUsageFlagBits::eStorage;
+        // sRGB levels are written through a UNORM view. The sRGB format itself
+        // rarely supports storage, so storage usage must only apply to views.
+        if (texture->format != vk::Format::eR8G8B8A8Unorm) {
+            imageCreateFlags |= vk::ImageCreateFlagBits::eMutableFormat |
+                                vk::ImageCreateFlagBits::eExtendedUsage;
+        }
+    }
+    vk::ImageCreateInfo imageCreateInfo = {
+        .flags = imageCreateFlags,
+        .imageType = vk::ImageType::e2D,
+        .format = texture->format,
+        .extent = { .width = texture->extent.width,
+                    .height = texture->extent.height,
+                    .depth = 1 },
+        .mipLevels = texture->mipLevels,
+        .arrayLayers = 1,
+        .samples = vk::SampleCountFlagBits::e1,
+        .tiling = vk::ImageTiling::eOptimal,
+        .usage = imageUsage,
+        .sharingMode = vk::SharingMode::eExclusive,
+        .initialLayout = vk::ImageLayout::eUndefined
+    };
+    texture->handle = this->handle->createImageUnique(imageCreateInfo);
+
+    vk::MemoryRequirements memoryRequirements =
+        this->handle->getImageMemoryRequirements(texture->handle.get());
+    std::optional<uint32_t> memoryTypeIndex =
+        this->FindMemoryTypeIndex(memoryRequirements.memoryTypeBits,
+                                  vk::MemoryPropertyFlagBits::eDeviceLocal);
+    if (memoryTypeIndex.has_value() == false) {
+        ErrorCallback(
+            "Failed to find a viable memory type for a Vulkan image.");
+        return nullptr;
+    }
+    texture->memory = this->handle->allocateMemoryUnique(
+        { .allocationSize = memoryRequirements.size,
+          .memoryTypeIndex = memoryTypeIndex.value() });
+    this->handle->bindImageMemory(
+        texture->handle.get(), texture->memory.get(), 0);
+
+    // The compute fallback reads each level through a sampled view and writes
+    // the next level through a storage view. These must outlive the upload.
+    std::vector<vk::UniqueImageView> mipmapViews;
+    vk::UniqueDescriptorPool mipmapDescriptorPool;
+    std::vector<vk::DescriptorSet> mipmapDescriptorSets;
+    if (computeMipmaps) {
+        pipeline_ptr pipeline = this->GetMipmapPipeline();
+        if (pipeline == nullptr) {
+            return nullptr;
+        }
+
+        uint32_t generatedLevels = texture->mipLevels - 1;
+        std::array<vk::DescriptorPoolSize, 2> poolSizes = {
+            vk::DescriptorPoolSize{
+                .type = vk::DescriptorType::eCombinedImageSampler,
+                .descriptorCount = generatedLevels },
+            vk::DescriptorPoolSize{ .type = vk::DescriptorType::eStorageImage,
+                                    .descriptorCount = generatedLevels }
+        };
+        mipmapDescriptorPool = this->handle->createDescriptorPoolUnique(
+            { .maxSets = generatedLevels,
+              .poolSizeCount = static_cast<uint32_t>(poolSizes.size()),
+              .pPoolSizes = poolSizes.data() });
+        std::vector<vk::DescriptorSetLayout> setLayouts(
+            generatedLevels, this->mipmapDescriptorSetLayout->handle.get());
+        mipmapDescriptorSets = this->handle->allocateDescriptorSets(
+            { .descriptorPool = mipmapDescriptorPool.get(),
+              .descriptorSetCount = generatedLevels,
+              .pSetLayouts = setLayouts.data() });
+
+        for (uint32_t level = 1; level < texture->mipLevels; ++level) {
+            vk::UniqueImageView& sourceView = mipmapViews.emplace_back(
+                this->handle->createImageViewUnique(
+                    { .image = texture->handle.get(),
+                      .viewType = vk::ImageViewType::e2D,
+                      .format = texture->format,
+                      .subresourceRange = {
+                          .aspectMask = vk::ImageAspectFlagBits::eColor,
+                          .baseMipLevel = level - 1,
+                          .levelCount = 1,
+                          .baseArrayLayer = 0,
+                          .layerCount = 1 } }));
+            vk::UniqueImageView& destinationView = mipmapViews.emplace_back(
+                this->handle->createImageViewUnique(
+                    { .image = texture->handle.get(),
+                      .viewType = vk::ImageViewType::e2D,
+                      .format = vk::Format::eR8G8B8A8Unorm,
+                      .subresourceRange = {
+                          .aspectMask = vk::ImageAspectFlagBits::eColor,
+                          .baseMipLevel = level,
+                          .levelCount = 1,
+                          .baseArrayLayer = 0,
+                          .layerCount = 1 } }));
+
+            vk::DescriptorImageInfo sourceImageInfo = {
+                .sampler = this->mipmapSampler.get(),
+                .imageView = sourceView.get(),
+                .imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal
+            };
+            vk::DescriptorImageInfo destinationImageInfo = {
+                .imageView = destinationView.get(),
+                .imageLayout = vk::ImageLayout::eGeneral
+            };
+            std::array<vk::WriteDescriptorSet, 2> writeDescriptorSets = {
+                vk::WriteDescriptorSet{
+                    .dstSet = mipmapDescriptorSets.at(level - 1),
+                    .dstBinding = 0,
+                    .descriptorCount = 1,
+                    .descriptorType = vk::DescriptorType::eCombinedImageSampler,
+                    .pImageInfo = &sourceImageInfo },
+                vk::WriteDescriptorSet{
+                    .dstSet = mipmapDescriptorSets.at(level - 1),
+                    .dstBinding = 1,
+                    .descriptorCount = 1,
+                    .descriptorType = vk::DescriptorType::eStorageImage,
+                    .pImageInfo = &destinationImageInfo }
+            };
+            this->handle->updateDescriptorSets(writeDescriptorSets, {});
+        }
+    }
+
+    // Transition the image for the copy, copy the pixels, generate mipmaps,
+    // and transition the image for sampling.
+    this->SubmitTransferCommands([&](vk::CommandBuffer Command_Buffer) {
+        internal::RecordImageLayoutTransition(
+            Command_Buffer,
+            texture->handle.get(),
+            0,
+            texture->mipLevels,
+            vk::ImageLayout::eUndefined,
+            vk::ImageLayout::eTransferDstOptimal,
+            {},
+            vk::AccessFlagBits::eTransferWrite,
+            vk::PipelineStageFlagBits::eTopOfPipe,
+            vk::PipelineStageFlagBits::eTransfer);
+
+        Command_Buffer.copyBufferToImage(
+            stagingBuffer->handle.get(),
+            texture->handle.get(),
+            vk::ImageLayout::eTransferDstOptimal,
+            vk::BufferImageCopy{
+                .bufferOffset = 0,
+                .bufferRowLength = 0,
+                .bufferImageHeight = 0,
+                .imageSubresource = { .aspectMask =
+                                          vk::ImageAspectFlagBits::eColor,
+                                      .mipLevel = 0,
+                                      .baseArrayLayer = 0,
+                                      .layerCount = 1 },
+                .imageOffset = { 0, 0, 0 },
+                .imageExtent = imageCreateInfo.extent });
+
+        if (blitMipmaps) {
+            RecordMipmapBlits(Command_Buffer, *texture);
+        } else if (computeMipmaps) {
+            this->RecordMipmapDispatches(
+                Command_Buffer, *texture, mipmapDescriptorSets);
+        } else {
+            internal::RecordImageLayoutTransition(
+                Command_Buffer,
+                texture->handle.get(),
+                0,
+                texture->mipLevels,
+                vk::ImageLayout::eTransferDstOptimal,
+                vk::ImageLayout::eShaderReadOnlyOptimal,
+                vk::AccessFlagBits::eTransferWrite,
+                vk::AccessFlagBits::eShaderRead,
+                vk::PipelineStageFlagBits::eTransfer,
+                vk::PipelineStageFlagBits::eFragmentShader |
+                    vk::PipelineStageFlagBits::eComputeShader);
+        }
+    });
+
+    texture->view = this->handle->createImageViewUnique(
+        { .image = texture->handle.get(),
+          .viewType = vk::ImageViewType::e2D,
+          .format = texture->format,
+          .subresourceRange = { .aspectMask = vk::ImageAspectFlagBits::eColor,
+                                .baseMipLevel = 0,
+                                .levelCount = texture->mipLevels,
+                                .baseArrayLayer = 0,
+                                .layerCount = 1 } });
+
+    texture->sampler = this->handle->createSamplerUnique(
+        { .magFilter = Texture_Info.magFilter,
+          .minFilter = Texture_Info.minFilter,
+          .mipmapMode = vk::SamplerMipmapMode::eLinear,
+          .addressModeU = Texture_Info.addressMode,
+          .addressModeV = Texture_Info.addressMode,
+          .addressModeW = Texture_Info.addressMode,
+          .maxLod = static_cast<float>(texture->mipLevels) });
+
+    return texture;
+}
+
+texture_ptr device::CreateTexture(const texture_info& Texture_Info)
+{
+    if (Texture_Info.image == nullptr) {
+        ErrorCallback("Cannot create a texture without an image.");
+        return nullptr;
+    }
+    const image& sourceImage = *Texture_Info.image;
+    if (sourceImage.data == nullptr) {
+        ErrorCallback("Cannot create a texture from an image without data.");
+        return nullptr;
+    }
+    if (sourceImage.dataColorComponentsPerPixel != 4) {
+        ErrorCallback("Textures require images with four color components per "
+                      "pixel.");
+        return nullptr;
+    }
+    // Return the existing texture if this image was already uploaded.
+    std::vector<uint64_t> key = {
+        reinterpret_cast<uint64_t>(&sourceImage),
+        static_cast<uint64_t>(Texture_Info.format),
+        static_cast<uint64_t>(Texture_Info.magFilter),
+        static_cast<uint64_t>(Texture_Info.minFilter),
+        static_cast<uint64_t>(Texture_Info.addressMode),
+        static_cast<uint64_t>(Texture_Info.generateMipmaps),
+        static_cast<uint64_t>(Texture_Info.premultiplyAlpha)
+    };
+    {
+        std::scoped_lock lock(this->texturesMutex);
+        auto cachedTexture = this->textures.find(key);
+        if (cachedTexture != this->textures.end()) {
+            texture_ptr existingTexture = cachedTexture->second.lock();
+            if (existingTexture != nullptr &&
+                existingTexture->source.lock() == Texture_Info.image) {
+                return existingTexture;
+            }
+        }
+    }
+
+    vk::Extent2D extent = {
+        .width = static_cast<uint32_t>(sourceImage.size.width),
+        .height = static_cast<uint32_t>(sourceImage.size.height)
+    };
+    texture_ptr texture = this->UploadTexture(
+        std::as_bytes(std::span(sourceImage.data,
+                                static_cast<size_t>(extent.width) *
+                                    extent.height * 4)),
+        extent,
+        Texture_Info);
+    if (texture == nullptr) {
+        return nullptr;
+    }
+    texture->source = Texture_Info.image;
+
+    {
+        std::scoped_lock lock(this->texturesMutex);
+        std::erase_if(this->textures, [](const auto& Texture) {
+            return Texture.second.expired();
+        });
+        this->textures.insert_or_assign(std::move(key), texture);
+    }
+
+    return texture;
+}
+
+texture_ptr device::CreateTexture(const image_ptr& Image)
+{
+    return this->CreateTexture(texture_info{ .image = Image });
+}
+
+atlas_ptr device::CreateAtlas(const atlas_info& Atlas_Info)
+{
+    if (Atlas_Info.pageSize == 0) {
+        ErrorCallback("Cannot create an atlas with empty pages.");
+        return nullptr;
+    }
+    for (const image_ptr& sourceImage : Atlas_Info.images) {
+        if (sourceImage == nullptr || sourceImage->data == nullptr) {
+            ErrorCallback("Cannot create an atlas from an image without data.");
+            return nullptr;
+        }
+        if (sourceImage->dataColorComponentsPerPixel != 4) {
+            ErrorCallback("Atlases require images with four color components "
+                          "per pixel.");
+            return nullptr;
+        }
+    }
+
+    // Place the tallest images first. Each image goes on the first page with
+    // room for it, and a new page is started when none has room.
+    std::vector<size_t> order(Atlas_Info.images.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t A, size_t B) {
+        return Atlas_Info.images[A]->size.height >
+               Atlas_Info.images[B]->size.height;
+    });
+
+    std::vector<internal::skyline_packer> packers;
+    std::vector<std::pair<uint32_t, coordinate<uint32_t>>> placements(
+        Atlas_Info.images.size());
+    for (size_t index : order) {
+        const image& sourceImage = *Atlas_Info.images[index];
+        uint32_t paddedWidth =
+            static_cast<uint32_t>(sourceImage.size.width) +
+            2 * Atlas_Info.padding;
+        uint32_t paddedHeight =
+            static_cast<uint32_t>(sourceImage.size.height) +
+            2 * Atlas_Info.padding;
+
+        std::optional<coordinate<uint32_t>> corner;
+        uint32_t page = 0;
+        for (; page < packers.size(); ++page) {
+            corner = packers[page].Insert(paddedWidth, paddedHeight);
+            if (corner.has_value()) {
+                break;
+            }
+        }
+        if (!corner.has_value()) {
+            packers.emplace_back(Atlas_Info.pageSize, Atlas_Info.pageSize);
+            corner = packers.back().Insert(paddedWidth, paddedHeight);
+            if (!corner.has_value()) {
+                ErrorCallback("An image is larger than the pages of the "
+                              "atlas.");
+                return nullptr;
+            }
+        }
+        placements[index] = { page, corner.value() };
+    }
+
+    // Copy every image into its page. The padding is filled by clamping to
+    // the nearest pixel of the image.
+    const size_t pageRowSize = static_cast<size_t>(Atlas_Info.pageSize) * 4;
+    std::vector<std::vector<std::byte>> pagePixels(
+        packers.size(),
+        std::vector<std::byte>(pageRowSize * Atlas_Info.pageSize));
+    atlas_ptr atlas = std::make_shared<internal::atlas_public_constructor>();
+    atlas->regions.reserve(Atlas_Info.images.size());
+    for (size_t index = 0; index < Atlas_Info.images.size(); ++index) {
+        const image& sourceImage = *Atlas_Info.images[index];
+        const auto& [page, corner] = placements[index];
+        const auto width = static_cast<uint32_t>(sourceImage.size.width);
+        const auto height = static_cast<uint32_t>(sourceImage.size.height);
+        const uint32_t padding = Atlas_Info.padding;
+
+        for (uint32_t y = 0; y < height + 2 * padding; ++y) {
+            uint32_t sourceY = std::clamp(y, padding, padding + height - 1) -
+                               padding;
+            std::byte* destinationRow = pagePixels[page].data() +
+                                        (corner.y + y) * pageRowSize +
+                                        static_cast<size_t>(corner.x) * 4;
+            const auto* sourceRow = reinterpret_cast<const std::byte*>(
+                sourceImage.data + static_cast<size_t>(sourceY) * width * 4);
+            for (uint32_t x = 0; x < padding; ++x) {
+                std::memcpy(destinationRow + static_cast<size_t>(x) * 4,
+                            sourceRow,
+                            4);
+                std::memcpy(destinationRow +
+                                static_cast<size_t>(padding + width + x) * 4,
+                            sourceRow + static_cast<size_t>(width - 1) * 4,
+                            4);
+            }
+            std::memcpy(destinationRow + static_cast<size_t>(padding) * 4,
+                        sourceRow,
+                        static_cast<size_t>(width) * 4);
+        }
+
+        const auto pageSize = static_cast<float>(Atlas_Info.pageSize);
+        const auto left = static_cast<float>(corner.x + padding);
+        const auto top = static_cast<float>(corner.y + padding);
+        atlas->regions.push_back(
+            { .page = page,
+              .uvMin = { left / pageSize, top / pageSize },
+              .uvMax = { (left + static_cast<float>(width)) / pageSize,
+                         (top + static_cast<float>(height)) / pageSize } });
+    }
+
+    // Images are only addressed inside their regions, so the pages clamp.
+    texture_info pageInfo = { .format = Atlas_Info.format,
+                              .magFilter = Atlas_Info.filter,
+                              .minFilter = Atlas_Info.filter,
+                              .addressMode =
+                                  vk::SamplerAddressMode::eClampToEdge,
+                              .generateMipmaps = Atlas_Info.generateMipmaps,
+                              .premultiplyAlpha = Atlas_Info.premultiplyAlpha };
+    atlas->pages.reserve(pagePixels.size());
+    for (const std::vector<std::byte>& pixels : pagePixels) {
+        texture_ptr page = this->UploadTexture(
+            pixels,
+            vk::Extent2D{ .width = Atlas_Info.pageSize,
+                          .height = Atlas_Info.pageSize },
+            pageInfo);
+        if (page == nullptr) {
+            return nullptr;
+        }
+        atlas->pages.push_back(std::move(page));
+    }
+
+    return atlas;
+}
+
+buffer_ring_ptr device::CreateBufferRing(
+    const buffer_ring_info& Buffer_Ring_Info)
+{
+    if (Buffer_Ring_Info.frameCount == 0 ||
+        Buffer_Ring_Info.sizeInBytesPerFrame == 0) {
+        ErrorCallback("A buffer ring must have at least one frame and a "
+                      "non-zero size per frame.");
+        return nullptr;
+    }
+
+    // Dynamic offsets must be multiples of the minimum offset alignment for
+    // every descriptor type the buffer may be bound as.
+    vk::PhysicalDeviceLimits limits =
+        this->physicalDevice.getProperties().limits;
+    vk::DeviceSize alignment = 1;
+    if (Buffer_Ring_Info.usage & vk::BufferUsageFlagBits::eUniformBuffer) {
+        alignment =
+            std::max(alignment, limits.minUniformBufferOffsetAlignment);
+    }
+    if (Buffer_Ring_Info.usage & vk::BufferUsageFlagBits::eStorageBuffer) {
+        alignment =
+            std::max(alignment, limits.minStorageBufferOffsetAlignment);
+    }
+
+    // Round the size of each region up so every region begins at an aligned
+    // offset.
+    vk::DeviceSize regionSize =
+        (Buffer_Ring_Info.sizeInBytesPerFrame + alignment - 1) / alignment *
+        alignment;
+    if (regionSize * Buffer_Ring_Info.frameCount > UINT32_MAX) {
+        ErrorCallback("A buffer ring must be addressable with 32-bit dynamic "
+                      "offsets.");
+        return nullptr;
+    }
+
+    buffer_ptr ringBuffer = this->CreateBuffer(
+        { .sizeInBytes = regionSize * Buffer_Ring_Info.frameCount,
+          .usage = Buffer_Ring_Info.usage,
+          .memoryProperties = vk::MemoryPropertyFlagBits::eHostVisible |
+                              vk::MemoryPropertyFlagBits::eHostCoherent });
+    if (ringBuffer == nullptr) {
+        return nullptr;
+    }
+
+    // The memory stays mapped until it is freed.
+    void* mappedMemory = this->handle->mapMemory(
+        ringBuffer->memory.get(), 0, ringBuffer->size, {});
+    ringBuffer->persistentMapping = mappedMemory;
+
+    return std::make_shared<internal::buffer_ring_public_constructor>(
+        std::move(ringBuffer),
+        mappedMemory,
+        alignment,
+        regionSize,
+        Buffer_Ring_Info.frameCount);
+}
+
+descriptor_set_layout_ptr device::CreateDescriptorSetLayout(
+    const descriptor_set_layout_info& Descriptor_Set_Layout_Info)
+{
+    if (!Descriptor_Set_Layout_Info.bindingFlags.empty() &&
+        Descriptor_Set_Layout_Info.bindingFlags.size() !=
+            Descriptor_Set_Layout_Info.bindings.size()) {
+        ErrorCallback("Descriptor binding flags must be empty or specified "
+                      "for every binding.");
+        return nullptr;
+    }
+    vk::DescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsCreateInfo = {
+        .bindingCount = static_cast<uint32_t>(
+            Descriptor_Set_Layout_Info.bindingFlags.size()),
+        .pBindingFlags = Descriptor_Set_Layout_Info.bindingFlags.data()
+    };
+
+    vk::DescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = {
+        .pNext = Descriptor_Set_Layout_Info.bindingFlags.empty()
+                     ? nullptr
+                     : &bindingFlagsCreateInfo,
+        .flags = Descriptor_Set_Layout_Info.flags,
+        .bindingCount =
+            static_cast<uint32_t>(Descriptor_Set_Layout_Info.bindings.size()),
+        .pBindings = Descriptor_Set_Layout_Info.bindings.data()
+    };
+    return std::make_shared<internal::descriptor_set_layout_public_constructor>(
+        this->handle->createDescriptorSetLayoutUnique(
+            descriptorSetLayoutCreateInfo),
+        Descriptor_Set_Layout_Info.bindings);
+}
+
+void device::AddDescriptorPoolNoMutex()
+{
+    constexpr uint32_t MAX_SETS = 256;
+    constexpr uint32_t DESCRIPTORS_PER_TYPE = 256;
+    std::array<vk::DescriptorPoolSize, 8> poolSizes = {
+        { { .type = vk::DescriptorType::eSampler,
+            .descriptorCount = DESCRIPTORS_PER_TYPE },
+          { .type = vk::DescriptorType::eCombinedImageSampler,
+            .descriptorCount = DESCRIPTORS_PER_TYPE },
+          { .type = vk::DescriptorType::eSampledImage,
+            .descriptorCount = DESCRIPTORS_PER_TYPE },
+          { .type = vk::DescriptorType::eStorageImage,
+            .descriptorCount = DESCRIPTORS_PER_TYPE },
+          { .type = vk::DescriptorType::eUniformBuffer,
+            .descriptorCount = DESCRIPTORS_PER_TYPE },
+          { .type = vk::DescriptorType::eStorageBuffer,
+            .descriptorCount = DESCRIPTORS_PER_TYPE },
+          { .type = vk::DescriptorType::eUniformBufferDynamic,
+            .descriptorCount = DESCRIPTORS_PER_TYPE },
+          { .type = vk::DescriptorType::eStorageBufferDynamic,
+            .descriptorCount = DESCRIPTORS_PER_TYPE } }
+    };
+    vk::DescriptorPoolCreateInfo descriptorPoolCreateInfo = {
+        .maxSets = MAX_SETS,
+        .poolSizeCount = static_cast<uint32_t>(poolSizes.size()),
+        .pPoolSizes = poolSizes.data()
+    };
+    this->descriptorPools.emplace_back(
+        this->handle->createDescriptorPoolUnique(descriptorPoolCreateInfo));
+}
+
+vk::DescriptorSet device::AllocateDescriptorSet(
+    const descriptor_set_layout_ptr& Descriptor_Set_Layout)
+{
+    std::scoped_lock lock(this->descriptorPoolsMutex);
+
+    if (this->descriptorPools.empty()) {
+        this->AddDescriptorPoolNoMutex();
+    }
+
+    vk::DescriptorSetLayout descriptorSetLayout =
+        Descriptor_Set_Layout->handle.get();
+    vk::DescriptorSet descriptorSet;
+
+    // Allocate from the newest pool. If it is exhausted, add another pool and
+    // try once more.
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo = {
+            .descriptorPool = this->descriptorPools.back().get(),
+            .descriptorSetCount = 1,
+            .pSetLayouts = &descriptorSetLayout
+        };
+        vk::Result result = this->handle->allocateDescriptorSets(
+            &descriptorSetAllocateInfo, &descriptorSet);
+        if (result == vk::Result::eSuccess) {
+            return descriptorSet;
+        }
+        if (result != vk::Result::eErrorOutOfPoolMemory &&
+            result != vk::Result::eErrorFragmentedPool) {
+            break;
+        }
+        this->AddDescriptorPoolNoMutex();
+    }
+
+    ErrorCallback("Failed to allocate a descriptor set.");
+    return nullptr;
+}
+
+void device::WriteDescriptorSetBuffer(vk::DescriptorSet Descriptor_Set,
+                                      uint32_t Binding,
+                                      vk::DescriptorType Descriptor_Type,
+                                      const buffer_ptr& Buffer,
+                                      vk::DeviceSize Offset,
+                                      vk::DeviceSize Range)
+{
+    vk::DeviceSize range =
+        (Range == VK_WHOLE_SIZE) ? Buffer->size - Offset : Range;
+    if ((Descriptor_Type == vk::DescriptorType::eUniformBuffer ||
+         Descriptor_Type == vk::DescriptorType::eUniformBufferDynamic) &&
+        range > this->physicalDevice.getProperties()
+                    .limits.maxUniformBufferRange) {
+        ErrorCallback("The range of a uniform buffer descriptor exceeds the "
+                      "maximum uniform buffer range of the device.");
+        return;
+    }
+
+    vk::DescriptorBufferInfo descriptorBufferInfo = {
+        .buffer = Buffer->handle.get(), .offset = Offset, .range = Range
+    };
+    vk::WriteDescriptorSet writeDescriptorSet = {
+        .dstSet = Descriptor_Set,
+        .dstBinding = Binding,
+        .dstArrayElement = 0,
+        .descriptorCount = 1,
+        .descriptorType = Descriptor_Type,
+        .pBufferInfo = &descriptorBufferInfo
+    };
+    this->handle->updateDescriptorSets(writeDescriptorSet, {});
+}
+
+void device::WriteDescriptorSetBuffer(vk::DescriptorSet Descriptor_Set,
+                                      uint32_t Binding,
+                                      vk::DescriptorType Descriptor_Type,
+                                      const buffer_ring_ptr& Buffer_Ring,
+                                      vk::DeviceSize Range)
+{
+    if (Range > Buffer_Ring->GetRegionSize()) {
+        ErrorCallback("The range of a buffer ring descriptor must not exceed "
+                      "the size of the region of one frame.");
+        return;
+    }
+    this->WriteDescriptorSetBuffer(
+        Descriptor_Set,
+        Binding,
+        Descriptor_Type,
+        Buffer_Ring->GetBuffer(),
+        0,
+        (Range == 0) ? Buffer_Ring->GetRegionSize() : Range);
+}
+
+bool device::IsBindlessEnabled() const
+{
+    return this->bindlessInfo.enable;
+}
+
+descriptor_set_layout_ptr device::GetBindlessDescriptorSetLayout() const
+{
+    return this->bindlessDescriptorSetLayout;
+}
+
+vk::DescriptorSet device::GetBindlessDescriptorSet() const
+{
+    return this->bindlessDescriptorSet;
+}
+
+std::optional<uint32_t> device::RegisterBindlessSampledImage(
+    vk::ImageView Image_View,
+    vk::Sampler Sampler,
+    vk::ImageLayout Image_Layout)
+{
+    if (!this->bindlessInfo.enable) {
+        ErrorCallback("Bindless resources are not enabled on this device.");
+        return std::nullopt;
+    }
+
+    std::scoped_lock lock(this->bindlessMutex);
+    std::optional<uint32_t> index =
+        this->bindlessSampledImageIndices.Allocate();
+    if (!index.has_value()) {
+        ErrorCallback("The bindless sampled image array is full.");
+        return std::nullopt;
+    }
+
+    vk::DescriptorImageInfo descriptorImageInfo = { .sampler = Sampler,
+                                                    .imageView = Image_View,
+                                                    .imageLayout =
+                                                        Image_Layout };
+    vk::WriteDescriptorSet writeDescriptorSet = {
+        .dstSet = this->bindlessDescriptorSet,
+        .dstBinding = 0,
+        .dstArrayElement = index.value(),
+        .descriptorCount = 1,
+        .descriptorType = vk::DescriptorType::eCombinedImageSampler,
+        .pImageInfo = &descriptorImageInfo
+    };
+    this->handle->updateDescriptorSets(writeDescriptorSet, {});
+    return index;
+}
+
+std::optional<uint32_t> device::RegisterBindlessTexture(
+    const texture_ptr& Texture)
+{
+    return this->RegisterBindlessSampledImage(Texture->view.get(),
+                                              Texture->sampler.get());
+}
+
+std::optional<uint32_t> device::RegisterBindlessStorageBuffer(
+    const buffer_ptr& Buffer)
+{
+    if (!this->bindlessInfo.enable) {
+        ErrorCallback("Bindless resources are not enabled on this device.");
+        return std::nullopt;
+    }
+
+    std::scoped_lock lock(this->bindlessMutex);
+    std::optional<uint32_t> index =
+        this->bindlessStorageBufferIndices.Allocate();
+    if (!index.has_value()) {
+        ErrorCallback("The bindless storage buffer array is full.");
+        return std::nullopt;
+    }
+
+    vk::DescriptorBufferInfo descriptorBufferInfo = {
+        .buffer = Buffer->handle.get(), .offset = 0, .range = VK_WHOLE_SIZE
+    };
+    vk::WriteDescriptorSet writeDescriptorSet = {
+        .dstSet = this->bindlessDescriptorSet,
+        .dstBinding = 1,
+        .dstArrayElement = index.value(),
+        .descriptorCount = 1,
+        .descriptorType = vk::DescriptorType::eStorageBuffer,
+        .pBufferInfo = &descriptorBufferInfo
+    };
+    this->handle->updateDescriptorSets(writeDescriptorSet, {});
+    return index;
+}
+
+void device::UnregisterBindlessSampledImage(uint32_t Index)
+{
+    if (!this->bindlessInfo.enable) {
+        ErrorCallback("Bindless resources are not enabled on this device.");
+        return;
+    }
+
+    std::scoped_lock lock(this->bindlessMutex);
+    if (!this->bindlessSampledImageIndices.Release(Index)) {
+        ErrorCallback("Cannot unregister a bindless sampled image index that "
+                      "is not registered.");
+    }
+}
+
+void device::UnregisterBindlessStorageBuffer(uint32_t Index)
+{
+    if (!this->bindlessInfo.enable) {
+        ErrorCallback("Bindless resources are not enabled on this device.");
+        return;
+    }
+
+    std::scoped_lock lock(this->bindlessMutex);
+    if (!this->bindlessStorageBufferIndices.Release(Index)) {
+        ErrorCallback("Cannot unregister a bindless storage buffer index that "
+                      "is not registered.");
+    }
+}
+
 render_pass_ptr device::CreateRenderPass(
     const render_pass_info& Render_Pass_Info)
 {
@@ -351,8 +1693,169 @@ swapchain_ptr device::CreateSwapchain(const swapchain_info& Swapchain_Info)
     return swapchainInfo;
 }
 
+std::vector<uint64_t> device::PipelineKey(const pipeline_info& Pipeline_Info)
+{
+    // The first element distinguishes graphics pipelines from compute
+    // pipelines.
+    std::vector<uint64_t> key = { static_cast<uint64_t>(
+        vk::PipelineBindPoint::eGraphics) };
+    internal::AppendShaderToPipelineKey(key, Pipeline_Info.shaders.vertex);
+    internal::AppendShaderToPipelineKey(key, Pipeline_Info.shaders.fragment);
+
+    key.emplace_back(Pipeline_Info.shaders.vertex->bindingDescriptions.size());
+    for (const auto& binding :
+         Pipeline_Info.shaders.vertex->bindingDescriptions) {
+        key.emplace_back(binding.binding);
+        key.emplace_back(binding.stride);
+        key.emplace_back(static_cast<uint64_t>(binding.inputRate));
+    }
+    key.emplace_back(
+        Pipeline_Info.shaders.vertex->attributeDescriptions.size());
+    for (const auto& attribute :
+         Pipeline_Info.shaders.vertex->attributeDescriptions) {
+        key.emplace_back(attribute.location);
+        key.emplace_back(attribute.binding);
+        key.emplace_back(static_cast<uint64_t>(attribute.format));
+        key.emplace_back(attribute.offset);
+    }
+
+    key.emplace_back(Pipeline_Info.dynamicStates.size());
+    for (const auto& dynamicState : Pipeline_Info.dynamicStates) {
+        key.emplace_back(static_cast<uint64_t>(dynamicState));
+    }
+
+    internal::AppendLayoutToPipelineKey(key,
+                                        Pipeline_Info.pushConstantRanges,
+                                        Pipeline_Info.descriptorSetLayouts);
+
+    key.emplace_back(
+        std::hash<vk::RenderPass>{}(Pipeline_Info.renderPass->handle.get()));
+
+    const pipeline_color_blend& colorBlend = Pipeline_Info.colorBlend;
+    key.emplace_back(colorBlend.blendEnable);
+    key.emplace_back(static_cast<uint64_t>(colorBlend.srcColorBlendFactor));
+    key.emplace_back(static_cast<uint64_t>(colorBlend.dstColorBlendFactor));
+    key.emplace_back(static_cast<uint64_t>(colorBlend.colorBlendOp));
+    key.emplace_back(static_cast<uint64_t>(colorBlend.srcAlphaBlendFactor));
+    key.emplace_back(static_cast<uint64_t>(colorBlend.dstAlphaBlendFactor));
+    key.emplace_back(static_cast<uint64_t>(colorBlend.alphaBlendOp));
+    key.emplace_back(static_cast<VkColorComponentFlags>(
+        colorBlend.colorWriteMask));
+
+    return key;
+}
+
+std::vector<uint64_t> device::PipelineKey(
+    const compute_pipeline_info& Compute_Pipeline_Info)
+{
+    std::vector<uint64_t> key = { static_cast<uint64_t>(
+        vk::PipelineBindPoint::eCompute) };
+    internal::AppendShaderToPipelineKey(key, Compute_Pipeline_Info.shader);
+    internal::AppendLayoutToPipelineKey(
+        key,
+        Compute_Pipeline_Info.pushConstantRanges,
+        Compute_Pipeline_Info.descriptorSetLayouts);
+    return key;
+}
+
+pipeline_ptr device::FindPipeline(const std::vector<uint64_t>& Pipeline_Key)
+{
+    std::scoped_lock lock(this->pipelinesMutex);
+    if (auto existingPipeline = this->pipelines.find(Pipeline_Key);
+        existingPipeline != this->pipelines.end()) {
+        return existingPipeline->second.lock();
+    }
+    return nullptr;
+}
+
+pipeline_ptr device::InsertPipeline(std::vector<uint64_t> Pipeline_Key,
+                                    pipeline_ptr Pipeline)
+{
+    std::scoped_lock lock(this->pipelinesMutex);
+
+    // Another thread may have created an identical pipeline in the meantime.
+    if (auto existingPipeline = this->pipelines.find(Pipeline_Key);
+        existingPipeline != this->pipelines.end()) {
+        if (pipeline_ptr pipeline = existingPipeline->second.lock()) {
+            return pipeline;
+        }
+    }
+
+    // Forget pipelines that have been destroyed.
+    std::erase_if(this->pipelines, [](const auto& Pipeline) {
+        return Pipeline.second.expired();
+    });
+    this->pipelines.insert_or_assign(std::move(Pipeline_Key), Pipeline);
+    return Pipeline;
+}
+
+bool device::CreatePipelineLayout(
+    const pipeline_ptr& Pipeline,
+    const pipeline_push_constant_ranges& Push_Constant_Ranges,
+    const pipeline_descriptor_set_layouts& Descriptor_Set_Layouts)
+{
+    // Push constant ranges must be four byte aligned and fit within the
+    // device limit.
+    uint32_t maxPushConstantsSize =
+        this->physicalDevice.getProperties().limits.maxPushConstantsSize;
+    for (const auto& pushConstantRange : Push_Constant_Ranges) {
+        if (pushConstantRange.size == 0 ||
+            pushConstantRange.offset % 4 != 0 ||
+            pushConstantRange.size % 4 != 0) {
+            ErrorCallback("The offset and size of a push constant range must "
+                          "be multiples of four and the size must not be "
+                          "zero.");
+            return false;
+        }
+        if (pushConstantRange.offset + pushConstantRange.size >
+            maxPushConstantsSize) {
+            ErrorCallback(("A push constant range exceeds the maximum push "
+                           "constant size of the device (" +
+                           std::to_string(maxPushConstantsSize) + " bytes).")
+                              .c_str());
+            return false;
+        }
+    }
+
+    Pipeline->pushConstantRanges = Push_Constant_Ranges;
+    // Keep the descriptor set layouts alive as long as the pipeline.
+    Pipeline->descriptorSetLayouts = Descriptor_Set_Layouts;
+
+    std::vector<vk::DescriptorSetLayout> descriptorSetLayouts;
+    descriptorSetLayouts.reserve(Pipeline->descriptorSetLayouts.size());
+    for (const auto& descriptorSetLayout : Pipeline->descriptorSetLayouts) {
+        descriptorSetLayouts.emplace_back(descriptorSetLayout->handle.get());
+    }
+
+    // Pipeline layout creation.
+    vk::PipelineLayoutCreateInfo pipelineLayoutCreateInfo = {
+        .setLayoutCount = static_cast<uint32_t>(descriptorSetLayouts.size()),
+        .pSetLayouts = descriptorSetLayouts.data(),
+        .pushConstantRangeCount =
+            static_cast<uint32_t>(Pipeline->pushConstantRanges.size()),
+        .pPushConstantRanges = Pipeline->pushConstantRanges.data()
+    };
+    Pipeline->layout =
+        this->handle->createPipelineLayoutUnique(pipelineLayoutCreateInfo);
+    return true;
+}
+
 pipeline_ptr device::CreatePipeline(const pipeline_info& Pipeline_Info)
 {
+    if (Pipeline_Info.shaders.vertex == nullptr ||
+        Pipeline_Info.shaders.fragment == nullptr ||
+        Pipeline_Info.renderPass == nullptr) {
+        ErrorCallback("A graphics pipeline requires a vertex shader, a "
+                      "fragment shader, and a render pass.");
+        return nullptr;
+    }
+
+    // Return an identical pipeline if one is still alive.
+    std::vector<uint64_t> pipelineKey = PipelineKey(Pipeline_Info);
+    if (pipeline_ptr existingPipeline = this->FindPipeline(pipelineKey)) {
+        return existingPipeline;
+    }
+
     // Pipeline dynamic states (selects what is configurable after pipeline
     // creation).
     vk::PipelineDynamicStateCreateInfo dynamicState = {
@@ -416,18 +1919,8 @@ pipeline_ptr device::CreatePipeline(const pipeline_info& Pipeline_Info)
     // Color blending for the attached framebuffer. If blendEnable is
     // VK_FALSE, the rest of this struct (except for colorWriteMask) is
     // ignored and color blending is disabled.
-    vk::PipelineColorBlendAttachmentState pipelineColorBlendAttachmentState = {
-        .blendEnable = VK_FALSE,
-        .srcColorBlendFactor = vk::BlendFactor::eOne,
-        .dstColorBlendFactor = vk::BlendFactor::eZero,
-        .colorBlendOp = vk::BlendOp::eAdd,
-        .srcAlphaBlendFactor = vk::BlendFactor::eOne,
-        .dstAlphaBlendFactor = vk::BlendFactor::eZero,
-        .alphaBlendOp = vk::BlendOp::eAdd,
-        .colorWriteMask =
-            vk::ColorComponentFlagBits::eR | vk::ColorComponentFlagBits::eG |
-            vk::ColorComponentFlagBits::eB | vk::ColorComponentFlagBits::eA
-    };
+    vk::PipelineColorBlendAttachmentState pipelineColorBlendAttachmentState =
+        Pipeline_Info.colorBlend;
 
     // Global color blending.
     vk::PipelineColorBlendStateCreateInfo pipelineColorBlendStateCreateInfo = {
@@ -441,16 +1934,11 @@ pipeline_ptr device::CreatePipeline(const pipeline_info& Pipeline_Info)
 
     pipeline_ptr pipeline =
         std::make_shared<internal::pipeline_public_constructor>();
-
-    // Pipeline layout creation.
-    vk::PipelineLayoutCreateInfo pipelineLayoutCreateInfo = {
-        .setLayoutCount = 0,
-        .pSetLayouts = nullptr,
-        .pushConstantRangeCount = 0,
-        .pPushConstantRanges = nullptr
-    };
-    pipeline->layout =
-        this->handle->createPipelineLayoutUnique(pipelineLayoutCreateInfo);
+    if (!this->CreatePipelineLayout(pipeline,
+                                    Pipeline_Info.pushConstantRanges,
+                                    Pipeline_Info.descriptorSetLayouts)) {
+        return nullptr;
+    }
 
     std::vector<vk::PipelineShaderStageCreateInfo>
         pipelineShaderStageCreateInfos =
@@ -470,18 +1958,65 @@ pipeline_ptr device::CreatePipeline(const pipeline_info& Pipeline_Info)
         .pColorBlendState = &pipelineColorBlendStateCreateInfo,
         .pDynamicState = &dynamicState,
         .layout = pipeline->layout.get(),
-        .renderPass = Pipeline_Info.renderPass,
+        .renderPass = Pipeline_Info.renderPass->handle.get(),
         .subpass = 0,
         .basePipelineHandle = VK_NULL_HANDLE, // optional
         .basePipelineIndex = -1,              // optional
     };
     pipeline->handle = this->handle
                            ->createGraphicsPipelineUnique(
-                               VK_NULL_HANDLE, graphicsPipelineCreateInfo)
+                               this->pipelineCache.get(),
+                               graphicsPipelineCreateInfo)
+                           .value;
+    pipeline->shaders = Pipeline_Info.shaders;
+    pipeline->renderPass = Pipeline_Info.renderPass;
+
+    return this->InsertPipeline(std::move(pipelineKey), pipeline);
+}
+
+pipeline_ptr device::CreateComputePipeline(
+    const compute_pipeline_info& Compute_Pipeline_Info)
+{
+    if (Compute_Pipeline_Info.shader == nullptr) {
+        ErrorCallback("A compute pipeline requires a compute shader.");
+        return nullptr;
+    }
+
+    // Return an identical pipeline if one is still alive.
+    std::vector<uint64_t> pipelineKey = PipelineKey(Compute_Pipeline_Info);
+    if (pipeline_ptr existingPipeline = this->FindPipeline(pipelineKey)) {
+        return existingPipeline;
+    }
+
+    pipeline_ptr pipeline =
+        std::make_shared<internal::pipeline_public_constructor>();
+    if (!this->CreatePipelineLayout(
+            pipeline,
+            Compute_Pipeline_Info.pushConstantRanges,
+            Compute_Pipeline_Info.descriptorSetLayouts)) {
+        return nullptr;
+    }
+
+    const auto& shader = Compute_Pipeline_Info.shader;
+    vk::ComputePipelineCreateInfo computePipelineCreateInfo = {
+        .stage = { .stage = shader->stage,
+                   .module = shader->handle.get(),
+                   .pName = shader->entryPoint,
+                   .pSpecializationInfo = shader->specialization
+                                              ? &shader->specialization->info
+                                              : nullptr },
+        .layout = pipeline->layout.get(),
+        .basePipelineHandle = VK_NULL_HANDLE, // optional
+        .basePipelineIndex = -1               // optional
+    };
+    pipeline->handle = this->handle
+                           ->createComputePipelineUnique(
+                               this->pipelineCache.get(),
+                               computePipelineCreateInfo)
                            .value;
-    // The vertex shader and fragment shader modules may now destroyed.
+    pipeline->computeShader = Compute_Pipeline_Info.shader;
 
-    return pipeline;
+    return this->InsertPipeline(std::move(pipelineKey), pipeline);
 }
 
-} // namespace gvw
\ No newline at end of file
+} // namespace gvw
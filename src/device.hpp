@@ -7,6 +7,9 @@
  * @date 2023-07-26
  */
 
+// Standard includes
+#include <functional>
+
 // Local includes
 #include "gvw.ipp"
 
@@ -38,6 +41,127 @@ class device : internal::uncopyable_unmovable // NOLINT
     vk::SurfaceFormatKHR surfaceFormat;
     vk::PresentModeKHR presentMode;
     std::vector<device_selection_queue_family_info> queueFamilyInfos;
+    device_features enabledFeatures;
+    device_vulkan12_features enabledVulkan12Features;
+
+    /// @brief Descriptor pools. A new pool is appended when the last one is
+    /// exhausted.
+    std::vector<vk::UniqueDescriptorPool> descriptorPools;
+    std::mutex descriptorPoolsMutex;
+
+    /// @brief Bindless descriptor set and the indices in use within it.
+    device_bindless_info bindlessInfo;
+    descriptor_set_layout_ptr bindlessDescriptorSetLayout;
+    vk::UniqueDescriptorPool bindlessDescriptorPool;
+    vk::DescriptorSet bindlessDescriptorSet;
+    internal::index_allocator bindlessSampledImageIndices;
+    internal::index_allocator bindlessStorageBufferIndices;
+    std::mutex bindlessMutex;
+
+    /// @brief Pipeline cache shared by all pipelines created by this device.
+    vk::UniquePipelineCache pipelineCache;
+
+    /// @brief Live pipelines keyed by everything that affects their creation.
+    /// Requesting an identical pipeline returns the existing one.
+    std::map<std::vector<uint64_t>, std::weak_ptr<pipeline>> pipelines;
+    std::mutex pipelinesMutex;
+
+    /// @brief One mutex per queue of this device. Vulkan requires access to a
+    /// queue to be externally synchronized.
+    std::map<VkQueue, std::mutex> queueMutexes;
+
+    /// @brief Queue and command pool used to upload resources. The first
+    /// graphics queue is used so that blits are available.
+    vk::Queue transferQueue;
+    vk::UniqueCommandPool transferCommandPool;
+    std::mutex transferMutex;
+
+    /// @brief Live textures keyed by their source image and sampler settings.
+    /// Uploading an identical texture returns the existing one.
+    std::map<std::vector<uint64_t>, std::weak_ptr<texture>> textures;
+    std::mutex texturesMutex;
+
+    /// @brief Compute pipeline that generates mipmaps for formats without
+    /// linear blit support. Created on first use.
+    descriptor_set_layout_ptr mipmapDescriptorSetLayout;
+    pipeline_ptr mipmapPipeline;
+    vk::UniqueSampler mipmapSampler;
+    std::mutex mipmapMutex;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns the index of a memory type allowed by `Memory_Type_Bits`
+    /// with all of the requested properties.
+    [[nodiscard]] std::optional<uint32_t> FindMemoryTypeIndex(
+        uint32_t Memory_Type_Bits,
+        vk::MemoryPropertyFlags Memory_Properties) const;
+
+    /// @brief Records commands into a one time command buffer, submits it to
+    /// the transfer queue, and waits for it to complete.
+    void SubmitTransferCommands(
+        const std::function<void(vk::CommandBuffer)>& Record);
+
+    /// @brief Uploads tightly packed pixels with four bytes each to a texture
+    /// without caching it.
+    [[nodiscard]] texture_ptr UploadTexture(std::span<const std::byte> Pixels,
+                                            vk::Extent2D Extent,
+                                            const texture_info& Texture_Info);
+
+    /// @brief Returns true if mipmaps of a format can be generated with the
+    /// compute fallback.
+    [[nodiscard]] bool ComputeMipmapsSupported(vk::Format Format) const;
+
+    /// @brief Returns the compute pipeline that generates mipmaps, creating it
+    /// if necessary.
+    [[nodiscard]] pipeline_ptr GetMipmapPipeline();
+
+    /// @brief Records blits that generate every mip level from the previous
+    /// one. All levels must be in the transfer destination layout and end in
+    /// the shader read only layout.
+    static void RecordMipmapBlits(vk::CommandBuffer Command_Buffer,
+                                  const texture& Texture);
+
+    /// @brief Records dispatches that generate every mip level from the
+    /// previous one. All levels must be in the transfer destination layout and
+    /// end in the shader read only layout.
+    void RecordMipmapDispatches(
+        vk::CommandBuffer Command_Buffer,
+        const texture& Texture,
+        const std::vector<vk::DescriptorSet>& Descriptor_Sets);
+
+    /// @brief Appends a new descriptor pool to `descriptorPools`.
+    /// @warning This function is NOT thread safe.
+    void AddDescriptorPoolNoMutex();
+
+    /// @brief Creates the bindless descriptor set.
+    void CreateBindlessDescriptorSet();
+
+    /// @brief Returns the key identifying a graphics pipeline in `pipelines`.
+    [[nodiscard]] static std::vector<uint64_t> PipelineKey(
+        const pipeline_info& Pipeline_Info);
+
+    /// @brief Returns the key identifying a compute pipeline in `pipelines`.
+    [[nodiscard]] static std::vector<uint64_t> PipelineKey(
+        const compute_pipeline_info& Compute_Pipeline_Info);
+
+    /// @brief Returns the pipeline with a key if it is still alive.
+    [[nodiscard]] pipeline_ptr FindPipeline(
+        const std::vector<uint64_t>& Pipeline_Key);
+
+    /// @brief Adds a new pipeline to `pipelines` and returns it. If an
+    /// identical pipeline was added since `FindPipeline` failed, that pipeline
+    /// is returned instead.
+    pipeline_ptr InsertPipeline(std::vector<uint64_t> Pipeline_Key,
+                                pipeline_ptr Pipeline);
+
+    /// @brief Validates the push constant ranges and creates the layout of a
+    /// pipeline. Returns false if a push constant range is invalid.
+    [[nodiscard]] bool CreatePipelineLayout(
+        const pipeline_ptr& Pipeline,
+        const pipeline_push_constant_ranges& Push_Constant_Ranges,
+        const pipeline_descriptor_set_layouts& Descriptor_Set_Layouts);
 
   public:
     ////////////////////////////////////////////////////////////////////////////
@@ -50,6 +174,21 @@ class device : internal::uncopyable_unmovable // NOLINT
 
     [[nodiscard]] vk::SurfaceFormatKHR GetSurfaceFormat() const;
 
+    /// @brief Returns the mutex that must be held while submitting to,
+    /// presenting with, or waiting on a queue of this device.
+    [[nodiscard]] std::mutex& GetQueueMutex(vk::Queue Queue);
+
+    /// @brief Waits until every queue of this device is idle.
+    void WaitIdle();
+
+    /// @brief Returns the Vulkan 1.0 features enabled on this device.
+    [[nodiscard]] const device_features& GetEnabledFeatures() const;
+
+    /// @brief Returns the Vulkan 1.2 features enabled on this device,
+    /// including those enabled for bindless resources.
+    [[nodiscard]] const device_vulkan12_features& GetEnabledVulkan12Features()
+        const;
+
     [[nodiscard]] vk::PresentModeKHR GetPresentMode() const;
 
     [[nodiscard]] std::vector<device_selection_queue_family_info>
@@ -64,9 +203,108 @@ class device : internal::uncopyable_unmovable // NOLINT
     [[nodiscard]] fragment_shader_ptr LoadFragmentShaderFromSpirVFile(
         const fragment_shader_info& Fragment_Shader_Info);
 
+    [[nodiscard]] compute_shader_ptr LoadComputeShaderFromSpirVFile(
+        const compute_shader_info& Compute_Shader_Info);
+
     [[nodiscard]] buffer_ptr CreateBuffer(
         const buffer_info& Buffer_Info = buffer_info_config::DEFAULT);
 
+    /// @brief Copies bytes into a host visible buffer. Persistently mapped
+    /// buffers are written through their existing mapping.
+    void WriteBuffer(const buffer_ptr& Buffer,
+                     std::span<const std::byte> Data,
+                     vk::DeviceSize Offset = 0);
+
+    [[nodiscard]] buffer_ring_ptr CreateBufferRing(
+        const buffer_ring_info& Buffer_Ring_Info =
+            buffer_ring_info_config::UNIFORM);
+
+    /// @brief Uploads an image to a sampled texture through a staging buffer.
+    /// Uploading the same image with the same settings again returns the
+    /// existing texture.
+    /// @remark Submits to the first graphics queue while holding its queue
+    /// mutex, so it may be called from any thread.
+    [[nodiscard]] texture_ptr CreateTexture(const texture_info& Texture_Info);
+
+    [[nodiscard]] texture_ptr CreateTexture(const image_ptr& Image);
+
+    /// @brief Packs images into as few textures as possible and uploads them.
+    /// @remark Submits to the first graphics queue while holding its queue
+    /// mutex, so it may be called from any thread.
+    [[nodiscard]] atlas_ptr CreateAtlas(const atlas_info& Atlas_Info);
+
+    [[nodiscard]] descriptor_set_layout_ptr CreateDescriptorSetLayout(
+        const descriptor_set_layout_info& Descriptor_Set_Layout_Info =
+            descriptor_set_layout_info_config::DEFAULT);
+
+    /// @brief Allocates a descriptor set from the descriptor pools of this
+    /// device.
+    /// @remark The descriptor set is valid until the device is destroyed.
+    /// Descriptor sets cannot be freed individually, so allocate them once and
+    /// rewrite their bindings instead of allocating new sets every frame. The
+    /// memory of every set is only released with the device.
+    [[nodiscard]] vk::DescriptorSet AllocateDescriptorSet(
+        const descriptor_set_layout_ptr& Descriptor_Set_Layout);
+
+    /// @brief Points a buffer binding of a descriptor set at a buffer. For
+    /// dynamic descriptor types, `Range` is the size of the data read by each
+    /// draw and the offset is supplied when the set is bound.
+    void WriteDescriptorSetBuffer(vk::DescriptorSet Descriptor_Set,
+                                  uint32_t Binding,
+                                  vk::DescriptorType Descriptor_Type,
+                                  const buffer_ptr& Buffer,
+                                  vk::DeviceSize Offset = 0,
+                                  vk::DeviceSize Range = VK_WHOLE_SIZE);
+
+    /// @brief Points a dynamic buffer binding of a descriptor set at a buffer
+    /// ring. `Range` is the size of the data read by each draw. Zero selects
+    /// the size of the region of one frame, which only allows binding the
+    /// first allocation of each frame.
+    void WriteDescriptorSetBuffer(vk::DescriptorSet Descriptor_Set,
+                                  uint32_t Binding,
+                                  vk::DescriptorType Descriptor_Type,
+                                  const buffer_ring_ptr& Buffer_Ring,
+                                  vk::DeviceSize Range = 0);
+
+    /// @brief Returns true if the device was created with bindless resources.
+    [[nodiscard]] bool IsBindlessEnabled() const;
+
+    /// @brief Returns the layout of the bindless descriptor set. Binding 0 is
+    /// an array of combined image samplers and binding 1 is an array of
+    /// storage buffers.
+    [[nodiscard]] descriptor_set_layout_ptr GetBindlessDescriptorSetLayout()
+        const;
+
+    /// @brief Returns the bindless descriptor set.
+    [[nodiscard]] vk::DescriptorSet GetBindlessDescriptorSet() const;
+
+    /// @brief Writes a sampled image into the bindless descriptor set and
+    /// returns its index, or nothing if the array is full.
+    [[nodiscard]] std::optional<uint32_t> RegisterBindlessSampledImage(
+        vk::ImageView Image_View,
+        vk::Sampler Sampler,
+        vk::ImageLayout Image_Layout = vk::ImageLayout::eShaderReadOnlyOptimal);
+
+    /// @brief Writes a texture into the bindless descriptor set and returns
+    /// its index, or nothing if the array is full.
+    [[nodiscard]] std::optional<uint32_t> RegisterBindlessTexture(
+        const texture_ptr& Texture);
+
+    /// @brief Writes a storage buffer into the bindless descriptor set and
+    /// returns its index, or nothing if the array is full.
+    [[nodiscard]] std::optional<uint32_t> RegisterBindlessStorageBuffer(
+        const buffer_ptr& Buffer);
+
+    /// @brief Releases the index of a sampled image for reuse. Indices that are
+    /// not registered are reported and ignored.
+    /// @warning Submitted work must no longer access the index.
+    void UnregisterBindlessSampledImage(uint32_t Index);
+
+    /// @brief Releases the index of a storage buffer for reuse. Indices that
+    /// are not registered are reported and ignored.
+    /// @warning Submitted work must no longer access the index.
+    void UnregisterBindlessStorageBuffer(uint32_t Index);
+
     [[nodiscard]] render_pass_ptr CreateRenderPass(
         const render_pass_info& Render_Pass_Info =
             render_pass_info_config::DEFAULT);
@@ -76,6 +314,10 @@ class device : internal::uncopyable_unmovable // NOLINT
 
     [[nodiscard]] pipeline_ptr CreatePipeline(
         const pipeline_info& Pipeline_Info = pipeline_info_config::DEFAULT);
+
+    [[nodiscard]] pipeline_ptr CreateComputePipeline(
+        const compute_pipeline_info& Compute_Pipeline_Info =
+            compute_pipeline_info_config::DEFAULT);
 };
 
 } // namespace gvw
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @file event_recording_format.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Binary layout of GVW window event recordings. Shared by GVW and its
+ * benchmarks, so it must not depend on anything but the standard library.
+ * @date 2023-10-11
+ */
+
+// Standard includes
+#include <array>
+#include <cstdint>
+
+namespace gvw::internal {
+
+/// @brief The first four bytes of every event recording.
+inline constexpr std::array<char, 4> EVENT_RECORDING_MAGIC = {
+    'G', 'V', 'W', 'E'
+};
+
+inline constexpr uint32_t EVENT_RECORDING_VERSION = 1;
+
+/// @brief The header at the start of an event recording: the magic followed by
+/// the version. It is followed by one record per event until the end of the
+/// file. Every field is written on its own without padding, and all numbers
+/// are little endian.
+struct event_recording_header
+{
+    std::array<char, 4> magic;
+    uint32_t version;
+};
+
+/// @brief The header of a recorded event: its time, type, and size in that
+/// order. It is followed by `size` bytes of event data, which hold the fields
+/// of the matching member of `gvw::window_event` in declaration order:
+///
+/// - Integers, enums, and GLFW booleans are 32 bits. Enums and booleans must
+///   hold values that GLFW reports.
+/// - Cursor positions and scroll offsets are two 64-bit floats.
+/// - Content scales are two 32-bit floats.
+/// - File drop events store a 32-bit path count followed by each path as a
+///   32-bit length and its characters.
+/// - Close and refresh events store nothing.
+struct event_record
+{
+    /// @brief Nanoseconds since the first recorded event.
+    uint64_t time;
+    /// @brief A `gvw::window_event_type`.
+    uint32_t type;
+    uint32_t size;
+};
+
+static_assert(sizeof(event_recording_header) == 8);
+static_assert(sizeof(event_record) == 16);
+
+} // namespace gvw::internal
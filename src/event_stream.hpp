@@ -0,0 +1,285 @@
+#pragma once
+
+/**
+ * @file event_stream.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief A lock-free event buffer that can coalesce high frequency events. Must
+ * not depend on anything but the standard library.
+ * @date 2023-10-08
+ */
+
+// Standard includes
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+// Local includes
+#include "seqlock.hpp"
+#include "spsc_ring.hpp"
+
+namespace gvw::internal {
+
+/// @brief How an event stream stores events that have not been drained.
+enum class event_coalescing
+{
+    /// @brief Every event is kept in order.
+    KEEP_ALL,
+
+    /// @brief Only the most recent event is kept.
+    KEEP_LATEST,
+
+    /// @brief A single event holding the sum of the changes since the last
+    /// drain is kept. Types without addition and subtraction keep the latest
+    /// event instead.
+    ACCUMULATE
+};
+
+/// @brief What an event stream does with an event that arrives while it is
+/// full.
+enum class event_overflow
+{
+    /// @brief The new event is dropped.
+    DROP_NEWEST,
+
+    /// @brief The oldest event that has not been drained is dropped. Drained
+    /// events are never dropped. While the consumer copies the stream, the new
+    /// event is dropped instead.
+    DROP_OLDEST,
+
+    /// @brief The producer waits until the consumer drains the stream.
+    BLOCK
+};
+
+/// @brief An `spsc_ring` with an optional coalescing policy. Coalesced events
+/// are kept in a fixed amount of memory regardless of how often they arrive.
+/// @warning The producer and consumer rules of `spsc_ring` apply.
+template<typename T>
+class event_stream
+{
+    static constexpr bool ARITHMETIC = requires(const T& Value) {
+        { Value + Value } -> std::convertible_to<T>;
+        { Value - Value } -> std::convertible_to<T>;
+    };
+
+    /// @brief Everything the producer shares with the consumer about coalesced
+    /// events.
+    struct coalesced
+    {
+        T latest;
+        T total;
+        uint64_t count;
+    };
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Values of a relative stream, such as scroll offsets, are changes
+    /// that accumulate by adding them. Values of an absolute stream, such as
+    /// cursor positions, accumulate by adding the difference between
+    /// consecutive values.
+    explicit event_stream(size_t Capacity, bool Relative = false)
+        : events(Capacity)
+        , relative(Relative)
+    {
+    }
+
+    event_stream(const event_stream&) = delete;
+    event_stream(event_stream&&) noexcept = delete;
+    event_stream& operator=(const event_stream&) = delete;
+    event_stream& operator=(event_stream&&) noexcept = delete;
+    ~event_stream() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    spsc_ring<T> events;
+    const bool relative;
+    std::atomic<event_coalescing> coalescing = event_coalescing::KEEP_ALL;
+    std::atomic<event_overflow> overflow = event_overflow::DROP_NEWEST;
+    std::atomic<size_t> dropped = 0;
+
+    seqlock<coalesced> shared;
+
+    // Producer only.
+    coalesced produced = {};
+
+    // Consumer only.
+    uint64_t drainedCount = 0;
+    T drainedTotal = {};
+    T drainedEvent = {};
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Changes how events that have not been drained are stored. Events
+    /// stored under the previous policy are discarded by the next drain.
+    void SetCoalescing(event_coalescing Coalescing)
+    {
+        this->coalescing.store(Coalescing, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] event_coalescing GetCoalescing() const
+    {
+        return this->coalescing.load(std::memory_order_relaxed);
+    }
+
+    void SetOverflow(event_overflow Overflow)
+    {
+        this->overflow.store(Overflow, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] event_overflow GetOverflow() const
+    {
+        return this->overflow.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Returns the number of events dropped because the stream was
+    /// full. Coalesced events are never dropped.
+    [[nodiscard]] size_t GetDropped() const
+    {
+        return this->dropped.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Appends or coalesces an event. Returns false if the event was
+    /// dropped because the stream is full. @warning With
+    /// `event_overflow::BLOCK` this waits for the consumer, so the consumer
+    /// must run on another thread. @remark Producer only.
+    bool Push(const T& Event)
+    {
+        return this->Append(Event, true);
+    }
+
+    /// @brief Like `Push`, except that with `event_overflow::BLOCK` it returns
+    /// false instead of waiting and the event is not counted as dropped.
+    /// @remark Producer only.
+    bool TryPush(const T& Event)
+    {
+        return this->Append(Event, false);
+    }
+
+    /// @brief Returns the events pushed since the last drain. Nothing is
+    /// copied. The returned view is valid until the next call to `Drain` or
+    /// `Clear`.
+    /// @remark Consumer only.
+    [[nodiscard]] spsc_ring_view<T> Drain()
+    {
+        event_coalescing policy = this->GetCoalescing();
+        if (policy == event_coalescing::KEEP_ALL) {
+            return this->events.Drain();
+        }
+
+        this->events.Clear();
+        coalesced current = this->shared.Load();
+        if (current.count == this->drainedCount) {
+            return {};
+        }
+        this->drainedEvent = current.latest;
+        if constexpr (ARITHMETIC) {
+            if (policy == event_coalescing::ACCUMULATE) {
+                this->drainedEvent = current.total - this->drainedTotal;
+            }
+        }
+        this->drainedTotal = current.total;
+        this->drainedCount = current.count;
+        return { std::span<const T>(&this->drainedEvent, 1), {} };
+    }
+
+    /// @brief Returns a copy of the events pushed since the last drain without
+    /// removing them.
+    /// @remark Consumer only.
+    [[nodiscard]] std::vector<T> Copy()
+    {
+        event_coalescing policy = this->GetCoalescing();
+        if (policy == event_coalescing::KEEP_ALL) {
+            return this->events.Copy();
+        }
+
+        coalesced current = this->shared.Load();
+        if (current.count == this->drainedCount) {
+            return {};
+        }
+        if constexpr (ARITHMETIC) {
+            if (policy == event_coalescing::ACCUMULATE) {
+                return { current.total - this->drainedTotal };
+            }
+        }
+        return { current.latest };
+    }
+
+    /// @brief Removes every event from the stream.
+    /// @remark Consumer only.
+    void Clear()
+    {
+        this->events.Clear();
+        coalesced current = this->shared.Load();
+        this->drainedTotal = current.total;
+        this->drainedCount = current.count;
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    bool Append(const T& Event, bool Wait)
+    {
+        event_coalescing policy = this->GetCoalescing();
+        if constexpr (ARITHMETIC) {
+            if (policy == event_coalescing::ACCUMULATE) {
+                if (this->relative) {
+                    this->produced.total = this->produced.total + Event;
+                } else if (this->produced.count != 0) {
+                    this->produced.total = this->produced.total +
+                                           (Event - this->produced.latest);
+                }
+            }
+        }
+        // The latest value is tracked under every policy so that switching an
+        // absolute stream to accumulation does not report a false jump.
+        this->produced.latest = Event;
+        ++this->produced.count;
+
+        if (policy != event_coalescing::KEEP_ALL) {
+            this->shared.Store(this->produced);
+            return true;
+        }
+        if (this->events.TryPush(Event)) {
+            return true;
+        }
+
+        switch (this->GetOverflow()) {
+            case event_overflow::DROP_NEWEST:
+                break;
+            case event_overflow::DROP_OLDEST:
+                if (this->events.TryDropOldest()) {
+                    this->dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (this->events.TryPush(Event)) {
+                    return true;
+                }
+                break;
+            case event_overflow::BLOCK:
+                if (!Wait) {
+                    return false;
+                }
+                while (!this->events.TryPush(Event)) {
+                    std::this_thread::yield();
+                }
+                return true;
+        }
+        this->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+};
+
+} // namespace gvw::internal
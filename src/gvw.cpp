@@ -1,16 +1,335 @@
 // Standard includes
 #include <string>
+#include <bit>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <type_traits>
+#include <optional>
+#include <vector>
 
 // External includes
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+// Platform includes
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // Local includes
 #include "../gvw/gvw.hpp"
 #include "impl.hpp"
 
 namespace gvw {
 
+#ifndef _WIN32
+namespace {
+
+/// @brief Reads a file that cannot be mapped, such as a pipe, to the end and
+/// copies it into page aligned memory that must be released with `munmap`.
+/// Returns `std::nullopt` if the file cannot be read.
+std::optional<std::span<const std::byte>> ReadUnmappableFile(int File)
+{
+    const size_t BLOCK_SIZE = 65536;
+    std::vector<std::byte> contents;
+    size_t size = 0;
+    while (true) {
+        contents.resize(size + BLOCK_SIZE);
+        ssize_t count = read(File, contents.data() + size, BLOCK_SIZE);
+        if (count == -1 && errno == EINTR) {
+            continue;
+        }
+        if (count == -1) {
+            return std::nullopt;
+        }
+        if (count == 0) {
+            break;
+        }
+        size += static_cast<size_t>(count);
+    }
+    if (size == 0) {
+        return std::span<const std::byte>{};
+    }
+
+    void* memory = mmap(nullptr,
+                        size,
+                        PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS,
+                        -1,
+                        0);
+    if (memory == MAP_FAILED) { // NOLINT
+        return std::nullopt;
+    }
+    std::memcpy(memory, contents.data(), size);
+    mprotect(memory, size, PROT_READ);
+    return std::span<const std::byte>{ static_cast<const std::byte*>(memory),
+                                       size };
+}
+
+} // namespace
+#endif
+
+file_view::file_view(const char* Path)
+{
+    if (Path == nullptr) {
+        ErrorCallback("Failed to open file. Path is NULL.");
+        return;
+    }
+    std::string failureMessage =
+        static_cast<std::string>("Failed to map file \"") + Path + "\".";
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(Path,
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    // Pipes and devices cannot be mapped.
+    if (GetFileType(file) != FILE_TYPE_DISK) {
+        CloseHandle(file);
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) == 0) {
+        CloseHandle(file);
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    this->size = static_cast<size_t>(fileSize.QuadPart);
+    if (this->size != 0) {
+        // The view keeps the mapping and the file open after their handles
+        // are closed.
+        HANDLE mapping =
+            CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = (mapping == nullptr)
+                         ? nullptr
+                         : MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (mapping != nullptr) {
+            CloseHandle(mapping);
+        }
+        if (view == nullptr) {
+            CloseHandle(file);
+            ErrorCallback(failureMessage.c_str());
+            return;
+        }
+        this->data = static_cast<const std::byte*>(view);
+    }
+    CloseHandle(file);
+#else
+    int file = open(Path, O_RDONLY | O_CLOEXEC); // NOLINT
+    if (file == -1) {
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    struct stat fileStatus = {};
+    if (fstat(file, &fileStatus) == -1) {
+        close(file);
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    // Pipes and files that report a size of zero, such as those in /proc,
+    // are read to the end instead of being mapped.
+    if (!S_ISREG(fileStatus.st_mode) || fileStatus.st_size == 0) {
+        std::optional<std::span<const std::byte>> contents =
+            ReadUnmappableFile(file);
+        close(file);
+        if (!contents.has_value()) {
+            ErrorCallback(failureMessage.c_str());
+            return;
+        }
+        this->data = contents->data();
+        this->size = contents->size();
+        this->opened = true;
+        return;
+    }
+    this->size = static_cast<size_t>(fileStatus.st_size);
+    // The mapping keeps the file open after its descriptor is closed.
+    void* mapping = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (mapping == MAP_FAILED) { // NOLINT
+        close(file);
+        this->size = 0;
+        ErrorCallback(failureMessage.c_str());
+        return;
+    }
+    // Assets are almost always read once from front to back.
+    madvise(mapping, this->size, MADV_SEQUENTIAL);
+    this->data = static_cast<const std::byte*>(mapping);
+    close(file);
+#endif
+
+    this->opened = true;
+}
+
+file_view::~file_view()
+{
+    if (this->data == nullptr) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(this->data);
+#else
+    munmap(const_cast<std::byte*>(this->data), this->size); // NOLINT
+#endif
+}
+
+std::span<const std::byte> file_view::GetData() const
+{
+    return { this->data, this->size };
+}
+
+archive::archive(const char* Path)
+    : file(MapFile(Path))
+{
+    if (this->file == nullptr) {
+        return;
+    }
+    std::string invalidMessage = static_cast<std::string>("\"") + Path +
+                                 "\" is not a valid GVW archive.";
+
+    std::span<const std::byte> fileData = this->file->GetData();
+    if (fileData.size() < sizeof(internal::archive_header)) {
+        ErrorCallback(invalidMessage.c_str());
+        return;
+    }
+    // Mappings are page aligned, so the header and table are read in place.
+    const auto* header =
+        reinterpret_cast<const internal::archive_header*>( // NOLINT
+            fileData.data());
+    if (header->magic != internal::ARCHIVE_MAGIC ||
+        header->version != internal::ARCHIVE_VERSION ||
+        !std::has_single_bit(header->tableSize) ||
+        header->tableSize >
+            (fileData.size() - sizeof(internal::archive_header)) /
+                sizeof(internal::archive_entry)) {
+        ErrorCallback(invalidMessage.c_str());
+        return;
+    }
+    this->table = { reinterpret_cast<const internal::archive_entry*>( // NOLINT
+                        fileData.data() + sizeof(internal::archive_header)),
+                    header->tableSize };
+
+    // Check every entry now so that lookups do not have to.
+    for (const auto& entry : this->table) {
+        if (entry.nameSize == 0) {
+            continue;
+        }
+        if (entry.nameOffset > fileData.size() ||
+            entry.nameSize > fileData.size() - entry.nameOffset ||
+            entry.dataOffset > fileData.size() ||
+            entry.dataSize > fileData.size() - entry.dataOffset ||
+            entry.dataOffset % internal::ARCHIVE_BLOB_ALIGNMENT != 0) {
+            ErrorCallback(invalidMessage.c_str());
+            return;
+        }
+    }
+
+    this->valid = true;
+}
+
+std::optional<std::span<const std::byte>> archive::Find(
+    std::string_view Name) const
+{
+    std::span<const std::byte> fileData = this->file->GetData();
+    uint64_t hash = internal::HashArchiveName(Name);
+    uint64_t mask = this->table.size() - 1;
+    for (uint64_t probe = 0; probe < this->table.size(); ++probe) {
+        const internal::archive_entry& entry =
+            this->table[(hash + probe) & mask];
+        if (entry.nameSize == 0) {
+            break;
+        }
+        if (entry.nameHash != hash || entry.nameSize != Name.size()) {
+            continue;
+        }
+        std::string_view entryName(
+            reinterpret_cast<const char*>( // NOLINT
+                fileData.data() + entry.nameOffset),
+            entry.nameSize);
+        if (entryName == Name) {
+            return fileData.subspan(entry.dataOffset, entry.dataSize);
+        }
+    }
+    return std::nullopt;
+}
+
+std::span<const uint32_t> archive::GetSpirV(std::string_view Name) const
+{
+    std::optional<std::span<const std::byte>> entryData = this->Find(Name);
+    if (!entryData.has_value()) {
+        ErrorCallback(("\"" + static_cast<std::string>(Name) +
+                       "\" is not in the archive.")
+                          .c_str());
+        return {};
+    }
+    if (entryData->empty() || entryData->size() % sizeof(uint32_t) != 0) {
+        ErrorCallback(("\"" + static_cast<std::string>(Name) +
+                       "\" is not a SPIR-V binary.")
+                          .c_str());
+        return {};
+    }
+    // Blobs are aligned to ARCHIVE_BLOB_ALIGNMENT.
+    return { reinterpret_cast<const uint32_t*>(entryData->data()), // NOLINT
+             entryData->size() / sizeof(uint32_t) };
+}
+
+image_ptr archive::DecodeImage(
+    std::string_view Name,
+    int Requested_Color_Components_Per_Pixel) const
+{
+    std::optional<std::span<const std::byte>> entryData = this->Find(Name);
+    if (!entryData.has_value()) {
+        ErrorCallback(("\"" + static_cast<std::string>(Name) +
+                       "\" is not in the archive.")
+                          .c_str());
+        return nullptr;
+    }
+    return CreateImage(image_memory_info{
+        .data = { reinterpret_cast<const uint8_t*>( // NOLINT
+                      entryData->data()),
+                  entryData->size() },
+        .requestedColorComponentsPerPixel =
+            Requested_Color_Components_Per_Pixel });
+}
+
+archive_ptr OpenArchive(const char* Path)
+{
+    if constexpr (std::endian::native != std::endian::little) {
+        ErrorCallback("GVW archives can only be read on little endian hosts.");
+        return nullptr;
+    }
+    archive_ptr archive =
+        std::make_shared<internal::archive_public_constructor>(Path);
+    if (!archive->valid) {
+        return nullptr;
+    }
+    return archive;
+}
+
+file_view_ptr MapFile(const char* Path)
+{
+    file_view_ptr fileView =
+        std::make_shared<internal::file_view_public_constructor>(Path);
+    if (!fileView->opened) {
+        return nullptr;
+    }
+    return fileView;
+}
+
 bool operator==(const version& Lhs, const version& Rhs)
 {
     return ((Lhs.major == Rhs.major) && (Lhs.minor == Rhs.minor) &&
@@ -105,7 +424,7 @@ int creation_hint_int::Get() const
 
 version GetGlfwRuntimeVersion() noexcept
 {
-    std::scoped_lock<std::mutex> lock(internal::global::GLFW_MUTEX);
+    std::scoped_lock lock(internal::global::GLFW_MUTEX);
     version glfwVersion = { .major = 0, .minor = 0, .revision = 0 };
     glfwGetVersion(
         &glfwVersion.major, &glfwVersion.minor, &glfwVersion.revision);
@@ -121,22 +440,20 @@ version GetGlfwCompiletimeVersion() noexcept
 
 image::image(const image_file_info& File_Info)
 {
-    this->data = stbi_load(File_Info.path,
-                           &this->size.width,
-                           &this->size.height,
-                           &this->colorComponentsPerPixel,
-                           File_Info.requestedColorComponentsPerPixel);
+    // Decode straight from the mapped file to avoid copying it.
+    file_view_ptr file = MapFile(File_Info.path);
+    if (file == nullptr) {
+        return;
+    }
+    std::span<const std::byte> fileData = file->GetData();
+    this->Decode({ reinterpret_cast<const uint8_t*>(fileData.data()), // NOLINT
+                   fileData.size() },
+                 File_Info.requestedColorComponentsPerPixel);
     if (this->data == nullptr) {
-        std::string message;
-        if (File_Info.path == nullptr) {
-            message =
-                static_cast<std::string>("Failed to open file. Path is NULL. ");
-        } else {
-            message = static_cast<std::string>("Failed to open file \"") +
-                      File_Info.path + "\". ";
-        }
-        message += static_cast<std::string>("STD error: \"") +
-                   stbi_failure_reason() + "\".";
+        std::string message =
+            static_cast<std::string>("Failed to read image file \"") +
+            File_Info.path + "\". STD error: \"" + stbi_failure_reason() +
+            "\".";
         ErrorCallback(message.c_str());
     }
     if (this->colorComponentsPerPixel <
@@ -153,13 +470,8 @@ image::image(const image_file_info& File_Info)
 
 image::image(const image_memory_info& Memory_Info)
 {
-    this->data =
-        stbi_load_from_memory(Memory_Info.data.data(),
-                              static_cast<int>(Memory_Info.data.size()),
-                              &this->size.width,
-                              &this->size.height,
-                              &this->colorComponentsPerPixel,
-                              Memory_Info.requestedColorComponentsPerPixel);
+    this->Decode(Memory_Info.data,
+                 Memory_Info.requestedColorComponentsPerPixel);
     if (this->data == nullptr) {
         std::string message =
             static_cast<std::string>(
@@ -183,6 +495,54 @@ image::~image()
     stbi_image_free(this->data);
 }
 
+void image::Decode(std::span<const uint8_t> Encoded_Data,
+                   int Requested_Color_Components_Per_Pixel)
+{
+    // stb expands pixels one component at a time, so expansions to RGBA are
+    // done here with the vectorized kernels instead.
+    const bool expandToRgba = (Requested_Color_Components_Per_Pixel == 4);
+    this->data = stbi_load_from_memory(
+        Encoded_Data.data(),
+        static_cast<int>(Encoded_Data.size()),
+        &this->size.width,
+        &this->size.height,
+        &this->colorComponentsPerPixel,
+        expandToRgba ? 0 : Requested_Color_Components_Per_Pixel);
+    if (this->data == nullptr) {
+        return;
+    }
+    this->dataColorComponentsPerPixel =
+        (Requested_Color_Components_Per_Pixel == 0)
+            ? this->colorComponentsPerPixel
+            : Requested_Color_Components_Per_Pixel;
+    if (!expandToRgba || this->colorComponentsPerPixel == 4) {
+        return;
+    }
+
+    const size_t pixelCount =
+        static_cast<size_t>(this->size.width) * this->size.height;
+    auto* rgbaData = static_cast<uint8_t*>(STBI_MALLOC(pixelCount * 4));
+    if (rgbaData == nullptr) {
+        // Let stb expand the pixels as it would without the kernels.
+        stbi_image_free(this->data);
+        this->data = stbi_load_from_memory(
+            Encoded_Data.data(),
+            static_cast<int>(Encoded_Data.size()),
+            &this->size.width,
+            &this->size.height,
+            &this->colorComponentsPerPixel,
+            Requested_Color_Components_Per_Pixel);
+        return;
+    }
+    internal::ExpandToRgba(
+        { this->data,
+          pixelCount * static_cast<size_t>(this->colorComponentsPerPixel) },
+        this->colorComponentsPerPixel,
+        { rgbaData, pixelCount * 4 });
+    stbi_image_free(this->data);
+    this->data = rgbaData;
+}
+
 area<int> image::GetSize() const
 {
     return this->size;
@@ -263,7 +623,7 @@ void GlfwErrorCallback(int Error_Code, const char* Message)
     internal::global::GLFW_ERROR_CALLBACK(Error_Code, Message);
 }
 
-const std::vector<instance_joystick_event>& GetJoystickEvents()
+std::vector<instance_joystick_event> GetJoystickEvents()
 {
     std::scoped_lock lock(internal::global::JOYSTICK_EVENTS_MUTEX);
     return internal::global::JOYSTICK_EVENTS;
@@ -275,6 +635,20 @@ void ClearJoystickEvents()
     internal::global::JOYSTICK_EVENTS.clear();
 }
 
+instance_joystick_state GetJoystickState(int JID)
+{
+    return internal::LoadJoystickState(JID);
+}
+
+instance_joystick_states GetJoystickStates()
+{
+    instance_joystick_states states = {};
+    for (int jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST; ++jid) {
+        states.at(size_t(jid)) = internal::LoadJoystickState(jid);
+    }
+    return states;
+}
+
 instance_ptr CreateInstance()
 {
     return CreateInstance(instance_info_config::DEFAULT);
@@ -352,6 +726,435 @@ window_creation_hints::window_creation_hints(
 {
 }
 
+namespace {
+
+/// @brief Appends a value to event data. Recordings are only written on
+/// little endian hosts, so the bytes of the value are already in file order.
+template<typename T>
+void Append(std::string& Data, T Value)
+{
+    static_assert(std::is_arithmetic_v<T>);
+    Data.append(reinterpret_cast<const char*>(&Value), // NOLINT
+                sizeof(Value));
+}
+
+/// @brief Reads a value from the front of event data and removes it. Returns
+/// false if there are not enough bytes left.
+template<typename T>
+[[nodiscard]] bool Read(std::span<const std::byte>& Data, T& Value)
+{
+    static_assert(std::is_arithmetic_v<T>);
+    if (Data.size() < sizeof(Value)) {
+        return false;
+    }
+    std::memcpy(&Value, Data.data(), sizeof(Value));
+    Data = Data.subspan(sizeof(Value));
+    return true;
+}
+
+/// @brief Returns true if a value read from a recording is `GLFW_TRUE` or
+/// `GLFW_FALSE`.
+bool IsGlfwBool(int32_t Value)
+{
+    return Value == GLFW_TRUE || Value == GLFW_FALSE;
+}
+
+/// @brief Returns true if a value read from a recording only has modifier key
+/// bits set.
+bool AreModifierKeys(int32_t Mods)
+{
+    const int32_t ALL_MODS = GLFW_MOD_SHIFT | GLFW_MOD_CONTROL | GLFW_MOD_ALT |
+                             GLFW_MOD_SUPER | GLFW_MOD_CAPS_LOCK |
+                             GLFW_MOD_NUM_LOCK;
+    return (Mods & ~ALL_MODS) == 0;
+}
+
+/// @brief Appends the data of any event but a file drop event field by field,
+/// as described in event_recording_format.hpp.
+void EncodeEvent(std::string& Data, const window_event& Event)
+{
+    switch (Event.type) {
+        case window_event_type::eKey:
+            Append(Data, int32_t(Event.key.key));
+            Append(Data, int32_t(Event.key.scancode));
+            Append(Data, int32_t(Event.key.action));
+            Append(Data, int32_t(Event.key.mods));
+            break;
+        case window_event_type::eCharacter:
+            Append(Data, uint32_t(Event.character));
+            break;
+        case window_event_type::eCursorPosition:
+            Append(Data, Event.cursorPosition.x);
+            Append(Data, Event.cursorPosition.y);
+            break;
+        case window_event_type::eCursorEnter:
+            Append(Data, int32_t(Event.cursorEnter));
+            break;
+        case window_event_type::eMouseButton:
+            Append(Data, int32_t(Event.mouseButton.button));
+            Append(Data, int32_t(Event.mouseButton.action));
+            Append(Data, int32_t(Event.mouseButton.mods));
+            break;
+        case window_event_type::eScroll:
+            Append(Data, Event.scroll.x);
+            Append(Data, Event.scroll.y);
+            break;
+        case window_event_type::eSize:
+            Append(Data, int32_t(Event.size.width));
+            Append(Data, int32_t(Event.size.height));
+            break;
+        case window_event_type::eFramebufferSize:
+            Append(Data, int32_t(Event.framebufferSize.width));
+            Append(Data, int32_t(Event.framebufferSize.height));
+            break;
+        case window_event_type::eContentScale:
+            Append(Data, Event.contentScale.x);
+            Append(Data, Event.contentScale.y);
+            break;
+        case window_event_type::ePosition:
+            Append(Data, int32_t(Event.position.x));
+            Append(Data, int32_t(Event.position.y));
+            break;
+        case window_event_type::eIconify:
+            Append(Data, int32_t(Event.iconify));
+            break;
+        case window_event_type::eMaximize:
+            Append(Data, int32_t(Event.maximize));
+            break;
+        case window_event_type::eFocus:
+            Append(Data, int32_t(Event.focus));
+            break;
+        case window_event_type::eFileDrop:
+        case window_event_type::eClose:
+        case window_event_type::eRefresh:
+            break;
+    }
+}
+
+/// @brief Parses the data written by `EncodeEvent` into the member of `Event`
+/// matching its type. Returns false if the data has the wrong size or holds a
+/// value that GLFW never reports, such as an unknown key action.
+[[nodiscard]] bool DecodeEvent(std::span<const std::byte> Data,
+                               window_event& Event)
+{
+    bool valid = true;
+    switch (Event.type) {
+        case window_event_type::eKey: {
+            int32_t key = 0;
+            int32_t scancode = 0;
+            int32_t action = 0;
+            int32_t mods = 0;
+            valid = Read(Data, key) && Read(Data, scancode) &&
+                    Read(Data, action) && Read(Data, mods) &&
+                    key >= GLFW_KEY_UNKNOWN && key <= GLFW_KEY_LAST &&
+                    (action == GLFW_RELEASE || action == GLFW_PRESS ||
+                     action == GLFW_REPEAT) &&
+                    AreModifierKeys(mods);
+            Event.key = { .key = window_key(key),
+                          .scancode = scancode,
+                          .action = window_key_action(action),
+                          .mods = mods };
+            break;
+        }
+        case window_event_type::eCharacter: {
+            uint32_t codepoint = 0;
+            const uint32_t LAST_CODEPOINT = 0x10FFFF;
+            valid = Read(Data, codepoint) && codepoint <= LAST_CODEPOINT;
+            Event.character = codepoint;
+            break;
+        }
+        case window_event_type::eCursorPosition:
+            Event.cursorPosition = {};
+            valid = Read(Data, Event.cursorPosition.x) &&
+                    Read(Data, Event.cursorPosition.y);
+            break;
+        case window_event_type::eCursorEnter: {
+            int32_t entered = 0;
+            valid = Read(Data, entered) && IsGlfwBool(entered);
+            Event.cursorEnter = entered;
+            break;
+        }
+        case window_event_type::eMouseButton: {
+            int32_t button = 0;
+            int32_t action = 0;
+            int32_t mods = 0;
+            valid = Read(Data, button) && Read(Data, action) &&
+                    Read(Data, mods) && button >= 0 &&
+                    button <= GLFW_MOUSE_BUTTON_LAST &&
+                    (action == GLFW_RELEASE || action == GLFW_PRESS) &&
+                    AreModifierKeys(mods);
+            Event.mouseButton = { .button = button,
+                                  .action = action,
+                                  .mods = mods };
+            break;
+        }
+        case window_event_type::eScroll:
+            Event.scroll = {};
+            valid = Read(Data, Event.scroll.x) && Read(Data, Event.scroll.y);
+            break;
+        case window_event_type::eSize:
+            Event.size = {};
+            valid = Read(Data, Event.size.width) &&
+                    Read(Data, Event.size.height);
+            break;
+        case window_event_type::eFramebufferSize:
+            Event.framebufferSize = {};
+            valid = Read(Data, Event.framebufferSize.width) &&
+                    Read(Data, Event.framebufferSize.height);
+            break;
+        case window_event_type::eContentScale:
+            Event.contentScale = {};
+            valid = Read(Data, Event.contentScale.x) &&
+                    Read(Data, Event.contentScale.y);
+            break;
+        case window_event_type::ePosition:
+            Event.position = {};
+            valid = Read(Data, Event.position.x) &&
+                    Read(Data, Event.position.y);
+            break;
+        case window_event_type::eIconify: {
+            int32_t iconified = 0;
+            valid = Read(Data, iconified) && IsGlfwBool(iconified);
+            Event.iconify = iconified;
+            break;
+        }
+        case window_event_type::eMaximize: {
+            int32_t maximized = 0;
+            valid = Read(Data, maximized) && IsGlfwBool(maximized);
+            Event.maximize = maximized;
+            break;
+        }
+        case window_event_type::eFocus: {
+            int32_t focused = 0;
+            valid = Read(Data, focused) && IsGlfwBool(focused);
+            Event.focus = focused;
+            break;
+        }
+        case window_event_type::eFileDrop:
+        case window_event_type::eClose:
+        case window_event_type::eRefresh:
+            break;
+    }
+    return valid && Data.empty();
+}
+
+} // namespace
+
+event_recorder::event_recorder(const char* Path)
+    : file(Path, std::ios::binary | std::ios::trunc)
+{
+    if (!this->file.is_open()) {
+        std::string message = static_cast<std::string>("Failed to create \"") +
+                              Path + "\".";
+        ErrorCallback(message.c_str());
+        return;
+    }
+    std::string header(internal::EVENT_RECORDING_MAGIC.begin(),
+                       internal::EVENT_RECORDING_MAGIC.end());
+    Append(header, internal::EVENT_RECORDING_VERSION);
+    this->file.write(header.data(), std::streamsize(header.size()));
+    this->opened = true;
+}
+
+void event_recorder::Record(const window_event& Event)
+{
+    if (!this->start.has_value()) {
+        this->start = Event.time;
+    }
+    auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Event.time - *this->start);
+
+    std::string data;
+    if (Event.type == window_event_type::eFileDrop) {
+        Append(data, uint32_t(Event.fileDrop.paths.size()));
+        for (std::string_view path : Event.fileDrop.paths) {
+            Append(data, uint32_t(path.size()));
+            data.append(path);
+        }
+    } else {
+        EncodeEvent(data, Event);
+    }
+
+    std::string record;
+    Append(record, uint64_t(std::max<int64_t>(time.count(), 0)));
+    Append(record, uint32_t(Event.type));
+    Append(record, uint32_t(data.size()));
+    this->file.write(record.data(), std::streamsize(record.size()));
+    this->file.write(data.data(), std::streamsize(data.size()));
+}
+
+void event_recorder::Record(window_events<window_event> Events)
+{
+    for (const window_event& event : Events) {
+        this->Record(event);
+    }
+}
+
+void event_recorder::Flush()
+{
+    this->file.flush();
+}
+
+event_recorder_ptr CreateEventRecorder(const char* Path)
+{
+    if constexpr (std::endian::native != std::endian::little) {
+        ErrorCallback("Event recordings can only be written on little endian "
+                      "hosts.");
+        return nullptr;
+    }
+    event_recorder_ptr recorder =
+        std::make_shared<internal::event_recorder_public_constructor>(Path);
+    if (!recorder->opened) {
+        return nullptr;
+    }
+    return recorder;
+}
+
+event_replayer::event_replayer(const char* Path)
+{
+    file_view_ptr file = MapFile(Path);
+    if (file == nullptr) {
+        return;
+    }
+    std::string invalidMessage = static_cast<std::string>("\"") + Path +
+                                 "\" is not a valid GVW event recording.";
+
+    std::span<const std::byte> data = file->GetData();
+    internal::event_recording_header header = {};
+    for (char& character : header.magic) {
+        if (!Read(data, character)) {
+            ErrorCallback(invalidMessage.c_str());
+            return;
+        }
+    }
+    if (!Read(data, header.version) ||
+        header.magic != internal::EVENT_RECORDING_MAGIC ||
+        header.version != internal::EVENT_RECORDING_VERSION) {
+        ErrorCallback(invalidMessage.c_str());
+        return;
+    }
+
+    // The paths of file drop events are pointed to once every path has been
+    // read, because `pathViews` may reallocate until then.
+    struct path_range
+    {
+        size_t event;
+        size_t first;
+        size_t count;
+    };
+    std::vector<path_range> pathRanges;
+    while (!data.empty()) {
+        internal::event_record record = {};
+        if (!Read(data, record.time) || !Read(data, record.type) ||
+            !Read(data, record.size) || record.size > data.size() ||
+            record.type > uint32_t(window_event_type::eRefresh)) {
+            ErrorCallback(invalidMessage.c_str());
+            return;
+        }
+        std::span<const std::byte> eventData = data.first(record.size);
+        data = data.subspan(record.size);
+
+        window_event event = {};
+        event.type = window_event_type(record.type);
+        event.time = window_event_time(
+            std::chrono::duration_cast<window_event_time::duration>(
+                std::chrono::nanoseconds(record.time)));
+        if (event.type == window_event_type::eFileDrop) {
+            uint32_t count = 0;
+            if (!Read(eventData, count)) {
+                ErrorCallback(invalidMessage.c_str());
+                return;
+            }
+            size_t first = this->pathViews.size();
+            for (uint32_t i = 0; i < count; ++i) {
+                uint32_t size = 0;
+                if (!Read(eventData, size) || size > eventData.size()) {
+                    ErrorCallback(invalidMessage.c_str());
+                    return;
+                }
+                const std::string& path = this->paths.emplace_back(
+                    reinterpret_cast<const char*>(eventData.data()), // NOLINT
+                    size);
+                this->pathViews.emplace_back(path);
+                eventData = eventData.subspan(size);
+            }
+            if (!eventData.empty()) {
+                ErrorCallback(invalidMessage.c_str());
+                return;
+            }
+            pathRanges.push_back({ this->events.size(), first, count });
+        } else if (!DecodeEvent(eventData, event)) {
+            ErrorCallback(invalidMessage.c_str());
+            return;
+        }
+        this->events.push_back(event);
+    }
+
+    for (const path_range& range : pathRanges) {
+        this->events[range.event].fileDrop.paths = {
+            this->pathViews.data() + range.first, range.count
+        };
+    }
+
+    this->valid = true;
+}
+
+size_t event_replayer::Replay(window& Window, double Speed)
+{
+    auto now = std::chrono::steady_clock::now();
+    if (!this->start.has_value()) {
+        this->start = now;
+    }
+    return this->ReplayUntil(
+        Window,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            (now - *this->start) * Speed));
+}
+
+size_t event_replayer::ReplayUntil(window& Window,
+                                   std::chrono::nanoseconds Time)
+{
+    size_t injected = 0;
+    while (!this->Finished() &&
+           this->events[this->next].time.time_since_epoch() <= Time) {
+        Window.InjectEvent(this->events[this->next]);
+        ++this->next;
+        ++injected;
+    }
+    return injected;
+}
+
+bool event_replayer::Finished() const
+{
+    return (this->next == this->events.size());
+}
+
+size_t event_replayer::Size() const
+{
+    return this->events.size();
+}
+
+void event_replayer::Rewind()
+{
+    this->next = 0;
+    this->start.reset();
+}
+
+event_replayer_ptr OpenEventRecording(const char* Path)
+{
+    if constexpr (std::endian::native != std::endian::little) {
+        ErrorCallback("Event recordings can only be read on little endian "
+                      "hosts.");
+        return nullptr;
+    }
+    event_replayer_ptr replayer =
+        std::make_shared<internal::event_replayer_public_constructor>(Path);
+    if (!replayer->valid) {
+        return nullptr;
+    }
+    return replayer;
+}
+
 cursor::cursor(cursor_standard_shape Cursor_Standard_Shape)
 {
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
@@ -360,12 +1163,31 @@ cursor::cursor(cursor_standard_shape Cursor_Standard_Shape)
 }
 
 cursor::cursor(const cursor_custom_shape_info& Cursor_Custom_Shape_Info)
+    : source(Cursor_Custom_Shape_Info.image)
 {
+    const gvw::image& cursorImage = *Cursor_Custom_Shape_Info.image;
+    // GLFW only accepts RGBA pixels.
+    std::vector<uint8_t> convertedPixels;
+    uint8_t* pixels = cursorImage.data;
+    if (cursorImage.dataColorComponentsPerPixel != 4) {
+        const size_t pixelCount =
+            static_cast<size_t>(cursorImage.size.width) *
+            cursorImage.size.height;
+        convertedPixels.resize(pixelCount * 4);
+        internal::ExpandToRgba(
+            { cursorImage.data,
+              pixelCount * static_cast<size_t>(
+                               cursorImage.dataColorComponentsPerPixel) },
+            cursorImage.dataColorComponentsPerPixel,
+            convertedPixels);
+        pixels = convertedPixels.data();
+    }
+
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
     // NOLINTNEXTLINE
-    GLFWimage image = { .width = Cursor_Custom_Shape_Info.image->size.width,
-                        .height = Cursor_Custom_Shape_Info.image->size.height,
-                        .pixels = Cursor_Custom_Shape_Info.image->data };
+    GLFWimage image = { .width = cursorImage.size.width,
+                        .height = cursorImage.size.height,
+                        .pixels = pixels };
     this->handle = glfwCreateCursor(&image,
                                     Cursor_Custom_Shape_Info.hotspot.x,
                                     Cursor_Custom_Shape_Info.hotspot.y);
@@ -376,15 +1198,160 @@ cursor::~cursor()
     glfwDestroyCursor(this->handle);
 }
 
+buffer_ring::buffer_ring(buffer_ptr Buffer,
+                         void* Mapped_Memory,
+                         vk::DeviceSize Alignment,
+                         vk::DeviceSize Region_Size,
+                         uint32_t Frame_Count)
+    : ringBuffer(std::move(Buffer))
+    , mappedMemory(static_cast<std::byte*>(Mapped_Memory))
+    , alignment(Alignment)
+    , regionSize(Region_Size)
+    , frameCount(Frame_Count)
+{
+}
+
+buffer_ptr buffer_ring::GetBuffer() const
+{
+    return this->ringBuffer;
+}
+
+vk::DeviceSize buffer_ring::GetRegionSize() const
+{
+    return this->regionSize;
+}
+
+std::optional<buffer_ring_allocation> buffer_ring::Allocate(
+    vk::DeviceSize Size_In_Bytes)
+{
+    vk::DeviceSize alignedOffset =
+        (this->regionOffset + this->alignment - 1) / this->alignment *
+        this->alignment;
+    if (alignedOffset + Size_In_Bytes > this->regionSize) {
+        ErrorCallback("The region of the current frame in a buffer ring is "
+                      "full. Increase the size of each region.");
+        return std::nullopt;
+    }
+    this->regionOffset = alignedOffset + Size_In_Bytes;
+
+    vk::DeviceSize offset = this->frameIndex * this->regionSize + alignedOffset;
+    return buffer_ring_allocation{ .data = this->mappedMemory + offset,
+                                   .offset = static_cast<uint32_t>(offset) };
+}
+
+void buffer_ring::NextFrame()
+{
+    this->frameIndex = (this->frameIndex + 1) % this->frameCount;
+    this->regionOffset = 0;
+}
+
+sprite_batch::sprite_batch(atlas_ptr Atlas,
+                           pipeline_ptr Pipeline,
+                           descriptor_set_layout_ptr Descriptor_Set_Layout,
+                           std::vector<vk::DescriptorSet> Page_Descriptor_Sets,
+                           buffer_ring_ptr Instance_Ring,
+                           uint32_t Max_Sprites)
+    : spriteAtlas(std::move(Atlas))
+    , spritePipeline(std::move(Pipeline))
+    , descriptorSetLayout(std::move(Descriptor_Set_Layout))
+    , pageDescriptorSets(std::move(Page_Descriptor_Sets))
+    , instanceRing(std::move(Instance_Ring))
+    , maxSprites(Max_Sprites)
+    , pageInstances(this->spriteAtlas->pages.size())
+{
+}
+
+bool sprite_batch::Add(const sprite& Sprite)
+{
+    if (this->spriteCount >= this->maxSprites) {
+        WarningCallback("A sprite batch is full. Increase the maximum number "
+                        "of sprites.");
+        return false;
+    }
+    if (Sprite.region >= this->spriteAtlas->regions.size()) {
+        ErrorCallback("A sprite refers to a region outside of its atlas.");
+        return false;
+    }
+
+    const atlas_region& region = this->spriteAtlas->regions[Sprite.region];
+    this->pageInstances[region.page].push_back({ .position = Sprite.position,
+                                                 .size = Sprite.size,
+                                                 .uvMin = region.uvMin,
+                                                 .uvMax = region.uvMax,
+                                                 .color = Sprite.color });
+    ++this->spriteCount;
+    return true;
+}
+
+void sprite_batch::Clear()
+{
+    for (std::vector<internal::sprite_instance>& instances :
+         this->pageInstances) {
+        instances.clear();
+    }
+    this->spriteCount = 0;
+}
+
+const std::vector<window_draw_info>& sprite_batch::Build()
+{
+    this->draws.clear();
+    this->instanceRing->NextFrame();
+    if (this->spriteCount == 0) {
+        return this->draws;
+    }
+
+    // Instances are written contiguously, grouped by page, so a single vertex
+    // buffer binding serves every draw.
+    std::optional<buffer_ring_allocation> allocation =
+        this->instanceRing->Allocate(this->spriteCount *
+                                     sizeof(internal::sprite_instance));
+    if (!allocation.has_value()) {
+        this->Clear();
+        return this->draws;
+    }
+
+    auto* instances =
+        static_cast<internal::sprite_instance*>(allocation->data);
+    uint32_t firstInstance = 0;
+    for (uint32_t page = 0; page < this->pageInstances.size(); ++page) {
+        const std::vector<internal::sprite_instance>& pageSprites =
+            this->pageInstances[page];
+        if (pageSprites.empty()) {
+            continue;
+        }
+        std::copy(
+            pageSprites.begin(), pageSprites.end(), instances + firstInstance);
+        this->draws.push_back(
+            { .vertexCount = 6,
+              .instanceCount = static_cast<uint32_t>(pageSprites.size()),
+              .firstInstance = firstInstance,
+              .descriptorSets = std::span(&this->pageDescriptorSets[page], 1),
+              .vertexBuffer = this->instanceRing->GetBuffer(),
+              .vertexBufferOffset = allocation->offset,
+              .pipeline = this->spritePipeline });
+        firstInstance += static_cast<uint32_t>(pageSprites.size());
+    }
+
+    this->Clear();
+    return this->draws;
+}
+
 std::vector<vk::PipelineShaderStageCreateInfo>
 pipeline_shaders::StageCreationInfos() const
 {
     return { { .stage = this->vertex->stage,
                .module = this->vertex->handle.get(),
-               .pName = this->vertex->entryPoint },
+               .pName = this->vertex->entryPoint,
+               .pSpecializationInfo = this->vertex->specialization
+                                          ? &this->vertex->specialization->info
+                                          : nullptr },
              { .stage = this->fragment->stage,
                .module = this->fragment->handle.get(),
-               .pName = this->fragment->entryPoint } };
+               .pName = this->fragment->entryPoint,
+               .pSpecializationInfo =
+                   this->fragment->specialization
+                       ? &this->fragment->specialization->info
+                       : nullptr } };
 }
 
 } // namespace gvw
\ No newline at end of file
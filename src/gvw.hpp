@@ -8,11 +8,18 @@
  */
 
 // Standard includes
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <vector>
 #include <optional>
 #include <mutex>
+#include <span>
+#include <map>
+#include <variant>
+#include <future>
+#include <string_view>
+#include <chrono>
 
 // External includes
 #define VULKAN_HPP_NAMESPACE vk
@@ -65,8 +72,19 @@ extern const std::vector<vk::VertexInputAttributeDescription>
     NO_VERTEX_ATTRIBUTE_DESCRIPTIONS;
 extern const std::vector<xy_rgb> NO_VERTICES;
 
+/// @brief A read only view of a file mapped into memory.
+class file_view;
+using file_view_ptr = std::shared_ptr<file_view>;
+
+/// @brief Maps a file into memory. Returns nullptr if it cannot be opened.
+/// @remark On POSIX systems, pipes and files that report a size of zero, such
+/// as those in /proc, are read into memory instead. On Windows, only files on
+/// disk can be opened.
+[[nodiscard]] file_view_ptr MapFile(const char* Path);
+
 /// @brief Reads a file from the file system.
 /// @tparam T Output buffer type. Almost always `char`.
+/// @remark Prefer `MapFile` to read a file without copying it.
 template<typename T = char>
 [[nodiscard]] std::vector<T> ReadFile(const char* Absolute_Path);
 
@@ -85,6 +103,30 @@ struct image_memory_info;
 template<typename T>
 [[nodiscard]] image_ptr CreateImage(const T& Info);
 
+/// @brief Decodes an image on a worker thread. When called from a task running
+/// on GVW's worker threads, the image is decoded before returning.
+/// @warning The path of an `image_file_info` must remain valid until the image
+/// is decoded.
+template<typename T>
+[[nodiscard]] std::future<image_ptr> CreateImageAsync(const T& Info);
+
+/// @brief Decodes images concurrently and waits for all of them.
+/// @remark When called from a task running on GVW's worker threads, the images
+/// are decoded one after another on the calling thread.
+template<typename T>
+[[nodiscard]] std::vector<image_ptr> CreateImages(
+    const std::vector<T>& Infos);
+
+/********************************    Archive    *******************************/
+/// @brief Named blobs packed into one file by the archive packer and mapped
+/// into memory.
+class archive;
+using archive_ptr = std::shared_ptr<archive>;
+
+/// @brief Maps an archive. Returns nullptr if the file cannot be opened or is
+/// not a valid archive.
+[[nodiscard]] archive_ptr OpenArchive(const char* Path);
+
 /*****************************    GVW Instance    *****************************/
 class instance;
 using instance_ptr = std::shared_ptr<instance>;
@@ -256,12 +298,27 @@ extern const instance_joystick_event_callback NONE;
 extern const instance_joystick_event_callback APPEND_TO_JOYSTICK_EVENT_BUFFER;
 } // namespace instance_joystick_event_callback_config
 
-/// @brief Returns the joystick event buffer.
-const std::vector<instance_joystick_event>& GetJoystickEvents();
+/// @brief Returns a copy of the joystick event buffer.
+[[nodiscard]] std::vector<instance_joystick_event> GetJoystickEvents();
 
 /// @brief Clears the joystick event buffer.
 void ClearJoystickEvents();
 
+/// @brief The axes, buttons, and hats of a joystick, and its gamepad state if
+/// it has a gamepad mapping.
+struct instance_joystick_state;
+using instance_joystick_states =
+    std::array<instance_joystick_state, GLFW_JOYSTICK_LAST + 1>;
+
+/// @brief Returns the state of a joystick as of the last time events were
+/// polled. Does not call GLFW or lock, so it may be called from any thread.
+[[nodiscard]] instance_joystick_state GetJoystickState(int JID);
+
+/// @brief Returns the state of every joystick as of the last time events were
+/// polled, indexed by joystick ID. Does not call GLFW or lock, so it may be
+/// called from any thread.
+[[nodiscard]] instance_joystick_states GetJoystickStates();
+
 /// @brief Initialize GVW with the default configuration.
 /// @remark Immediately returns if GVW is already initialized.
 instance_ptr CreateInstance();
@@ -315,17 +372,29 @@ using window_iconify_event = int;
 using window_maximize_event = int;
 using window_focus_event = int;
 
+/// @brief The type of a `gvw::window_event`.
+enum struct window_event_type;
+/// @brief The time at which a window event was received. Compare it with
+/// `std::chrono::steady_clock::now()` to measure input latency.
+using window_event_time = std::chrono::steady_clock::time_point;
+/// @brief Any window event tagged with its type and the time it was received.
+struct window_event;
+
 using window_key_event_callback =
     void (*)(GLFWwindow*, int, int, int, int); // GLFWkeyfun
 namespace window_key_event_callback_config {
 extern const window_key_event_callback NONE;
 extern const window_key_event_callback APPEND_TO_KEY_EVENT_BUFFER;
+extern const window_key_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_key_event_callback CALL_EVENT_HANDLER;
 } // namespace window_key_event_callback_config
 using window_character_event_callback = void (*)(GLFWwindow*,
                                                  unsigned int); // GLFWcharfun
 namespace window_character_event_callback_config {
 extern const window_character_event_callback NONE;
 extern const window_character_event_callback APPEND_TO_CHARACTER_EVENT_BUFFER;
+extern const window_character_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_character_event_callback CALL_EVENT_HANDLER;
 } // namespace window_character_event_callback_config
 using window_cursor_position_event_callback =
     void (*)(GLFWwindow*, double, double); // GLFWcursorposfun
@@ -333,6 +402,8 @@ namespace window_cursor_position_event_callback_config {
 extern const window_cursor_position_event_callback NONE;
 extern const window_cursor_position_event_callback
     APPEND_TO_CURSOR_POSITION_EVENT_BUFFER;
+extern const window_cursor_position_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_cursor_position_event_callback CALL_EVENT_HANDLER;
 } // namespace window_cursor_position_event_callback_config
 using window_cursor_enter_event_callback = void (*)(GLFWwindow*,
                                                     int); // GLFWcursorenterfun
@@ -340,6 +411,8 @@ namespace window_cursor_enter_event_callback_config {
 extern const window_cursor_enter_event_callback NONE;
 extern const window_cursor_enter_event_callback
     APPEND_TO_CURSOR_ENTER_EVENT_BUFFER;
+extern const window_cursor_enter_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_cursor_enter_event_callback CALL_EVENT_HANDLER;
 } // namespace window_cursor_enter_event_callback_config
 using window_mouse_button_event_callback = void (*)(GLFWwindow*,
                                                     int,
@@ -349,6 +422,8 @@ namespace window_mouse_button_event_callback_config {
 extern const window_mouse_button_event_callback NONE;
 extern const window_mouse_button_event_callback
     APPEND_TO_MOUSE_BUTTON_EVENT_BUFFER;
+extern const window_mouse_button_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_mouse_button_event_callback CALL_EVENT_HANDLER;
 } // namespace window_mouse_button_event_callback_config
 using window_scroll_event_callback = void (*)(GLFWwindow*,
                                               double,
@@ -356,6 +431,8 @@ using window_scroll_event_callback = void (*)(GLFWwindow*,
 namespace window_scroll_event_callback_config {
 extern const window_scroll_event_callback NONE;
 extern const window_scroll_event_callback APPEND_TO_SCROLL_EVENT_BUFFER;
+extern const window_scroll_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_scroll_event_callback CALL_EVENT_HANDLER;
 } // namespace window_scroll_event_callback_config
 using window_file_drop_event_callback = void (*)(GLFWwindow*,
                                                  int,
@@ -363,11 +440,15 @@ using window_file_drop_event_callback = void (*)(GLFWwindow*,
 namespace window_file_drop_event_callback_config {
 extern const window_file_drop_event_callback NONE;
 extern const window_file_drop_event_callback APPEND_TO_FILE_DROP_EVENT_BUFFER;
+extern const window_file_drop_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_file_drop_event_callback CALL_EVENT_HANDLER;
 } // namespace window_file_drop_event_callback_config
 using window_close_event_callback = void (*)(GLFWwindow*); // GLFWwindowclosefun
 namespace window_close_event_callback_config {
 extern const window_close_event_callback NONE;
 extern const window_close_event_callback APPEND_TO_CLOSE_EVENT_BUFFER;
+extern const window_close_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_close_event_callback CALL_EVENT_HANDLER;
 } // namespace window_close_event_callback_config
 using window_size_event_callback = void (*)(GLFWwindow*,
                                             int,
@@ -375,6 +456,8 @@ using window_size_event_callback = void (*)(GLFWwindow*,
 namespace window_size_event_callback_config {
 extern const window_size_event_callback NONE;
 extern const window_size_event_callback APPEND_TO_SIZE_EVENT_BUFFER;
+extern const window_size_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_size_event_callback CALL_EVENT_HANDLER;
 } // namespace window_size_event_callback_config
 using window_framebuffer_size_event_callback =
     void (*)(GLFWwindow*, int, int); // GLFWframebuffersizefun
@@ -382,6 +465,8 @@ namespace window_framebuffer_size_event_callback_config {
 extern const window_framebuffer_size_event_callback NONE;
 extern const window_framebuffer_size_event_callback
     APPEND_TO_FRAMEBUFFER_SIZE_EVENT_BUFFER;
+extern const window_framebuffer_size_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_framebuffer_size_event_callback CALL_EVENT_HANDLER;
 } // namespace window_framebuffer_size_event_callback_config
 using window_content_scale_event_callback =
     void (*)(GLFWwindow*, float, float); // GLFWwindowcontentscalefun
@@ -389,6 +474,8 @@ namespace window_content_scale_event_callback_config {
 extern const window_content_scale_event_callback NONE;
 extern const window_content_scale_event_callback
     APPEND_TO_CONTENT_SCALE_EVENT_BUFFER;
+extern const window_content_scale_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_content_scale_event_callback CALL_EVENT_HANDLER;
 } // namespace window_content_scale_event_callback_config
 using window_position_event_callback = void (*)(GLFWwindow*,
                                                 int,
@@ -396,38 +483,96 @@ using window_position_event_callback = void (*)(GLFWwindow*,
 namespace window_position_event_callback_config {
 extern const window_position_event_callback NONE;
 extern const window_position_event_callback APPEND_TO_POSITION_EVENT_BUFFER;
+extern const window_position_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_position_event_callback CALL_EVENT_HANDLER;
 } // namespace window_position_event_callback_config
 using window_iconify_event_callback = void (*)(GLFWwindow*,
                                                int); // GLFWwindowiconifyfun
 namespace window_iconify_event_callback_config {
 extern const window_iconify_event_callback NONE;
 extern const window_iconify_event_callback APPEND_TO_ICONIFY_EVENT_BUFFER;
+extern const window_iconify_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_iconify_event_callback CALL_EVENT_HANDLER;
 } // namespace window_iconify_event_callback_config
 using window_maximize_event_callback = void (*)(GLFWwindow*,
                                                 int); // GLFWwindowmaximizefun
 namespace window_maximize_event_callback_config {
 extern const window_maximize_event_callback NONE;
 extern const window_maximize_event_callback APPEND_TO_MAXIMIZE_EVENT_BUFFER;
+extern const window_maximize_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_maximize_event_callback CALL_EVENT_HANDLER;
 } // namespace window_maximize_event_callback_config
 using window_focus_event_callback = void (*)(GLFWwindow*,
                                              int); // GLFWwindowfocusfun
 namespace window_focus_event_callback_config {
 extern const window_focus_event_callback NONE;
 extern const window_focus_event_callback APPEND_TO_FOCUS_EVENT_BUFFER;
+extern const window_focus_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_focus_event_callback CALL_EVENT_HANDLER;
 } // namespace window_focus_event_callback_config
 using window_refresh_event_callback =
     void (*)(GLFWwindow*); // GLFWwindowrefreshfun
 namespace window_refresh_event_callback_config {
 extern const window_refresh_event_callback NONE;
 extern const window_refresh_event_callback APPEND_TO_REFRESH_EVENT_BUFFER;
+extern const window_refresh_event_callback APPEND_TO_EVENT_QUEUE;
+extern const window_refresh_event_callback CALL_EVENT_HANDLER;
 } // namespace window_refresh_event_callback_config
 
+/// @brief A single draw command recorded by `gvw::window::DrawFrame`.
+struct window_draw_info;
+
+/// @brief A compute dispatch recorded by `gvw::window::DrawFrame` before the
+/// render pass.
+struct window_dispatch_info;
+
+/// @brief How a window event buffer stores events that have not been drained.
+enum struct window_event_coalescing;
+
+/// @brief What a window event buffer does with an event that arrives while it
+/// is full.
+enum struct window_event_overflow;
+
+/// @brief The capacity and overflow policy of a window event buffer.
+struct window_event_buffer_info;
+/// @brief The capacity and overflow policy of every window event buffer.
+struct window_event_buffers_info;
+namespace window_event_buffers_info_config {
+extern const window_event_buffers_info DEFAULT;
+} // namespace window_event_buffers_info_config
+
+/// @brief The number of events each window event buffer has dropped.
+struct window_event_drop_counts;
+
 struct window_event_callbacks;
 namespace window_event_callbacks_config {
 extern const window_event_callbacks NONE;
 extern const window_event_callbacks APPEND_TO_EVENT_BUFFERS;
+extern const window_event_callbacks APPEND_TO_EVENT_QUEUE;
+extern const window_event_callbacks CALL_EVENT_HANDLERS;
 } // namespace window_event_callbacks_config
 
+/// @brief Callables that the `CALL_EVENT_HANDLER` event callbacks invoke as
+/// soon as an event is received.
+struct window_event_handlers;
+
+/// @brief Writes window events and the times they were received to a file.
+class event_recorder;
+using event_recorder_ptr = std::shared_ptr<event_recorder>;
+
+/// @brief Creates an event recording, replacing any file at the path. Returns
+/// nullptr if the file cannot be created.
+[[nodiscard]] event_recorder_ptr CreateEventRecorder(const char* Path);
+
+/// @brief Window events read from a recording that can be injected back into a
+/// window.
+class event_replayer;
+using event_replayer_ptr = std::shared_ptr<event_replayer>;
+
+/// @brief Reads an event recording. Returns nullptr if the file cannot be
+/// opened or is not a valid recording.
+[[nodiscard]] event_replayer_ptr OpenEventRecording(const char* Path);
+
 struct window_creation_hints_info;
 namespace window_creation_hints_info_config {
 extern const window_creation_hints_info DEFAULT;
@@ -479,6 +624,17 @@ namespace shader_info_config {
 extern const shader_info DEFAULT;
 } // namespace shader_info_config
 
+/// @brief The value of a specialization constant. Every alternative occupies
+/// four bytes in the specialization data (`bool` is stored as a `VkBool32`).
+using shader_specialization_constant =
+    std::variant<bool, int32_t, uint32_t, float>;
+/// @brief Specialization constant values by constant ID.
+using shader_specialization_constants =
+    std::map<uint32_t, shader_specialization_constant>;
+namespace shader_specialization_constants_config {
+extern const shader_specialization_constants NONE;
+} // namespace shader_specialization_constants_config
+
 class vertex_shader;
 using vertex_shader_ptr = std::shared_ptr<vertex_shader>;
 struct vertex_shader_info;
@@ -493,6 +649,13 @@ namespace fragment_shader_info_config {
 extern const fragment_shader_info DEFAULT;
 } // namespace fragment_shader_info_config
 
+class compute_shader;
+using compute_shader_ptr = std::shared_ptr<compute_shader>;
+struct compute_shader_info;
+namespace compute_shader_info_config {
+extern const compute_shader_info DEFAULT;
+} // namespace compute_shader_info_config
+
 /********************************    Buffer    ********************************/
 class buffer;
 using buffer_ptr = std::shared_ptr<buffer>;
@@ -501,6 +664,38 @@ namespace buffer_info_config {
 extern const buffer_info DEFAULT;
 } // namespace buffer_info_config
 
+/// @brief A persistently mapped buffer divided into one region per frame in
+/// flight. Data shared by all draws in a frame is suballocated from it and
+/// bound with dynamic offsets.
+class buffer_ring;
+using buffer_ring_ptr = std::shared_ptr<buffer_ring>;
+struct buffer_ring_info;
+namespace buffer_ring_info_config {
+extern const buffer_ring_info UNIFORM;
+extern const buffer_ring_info STORAGE;
+} // namespace buffer_ring_info_config
+struct buffer_ring_allocation;
+
+/********************************    Texture    *******************************/
+/// @brief A sampled image uploaded from a `gvw::image`.
+class texture;
+using texture_ptr = std::shared_ptr<texture>;
+struct texture_info;
+
+/*********************************    Atlas    ********************************/
+/// @brief Images packed into one or more textures.
+class atlas;
+using atlas_ptr = std::shared_ptr<atlas>;
+struct atlas_info;
+struct atlas_region;
+
+/*****************************    Sprite Batch    *****************************/
+/// @brief Draws textured quads from an atlas with one draw per atlas page.
+class sprite_batch;
+using sprite_batch_ptr = std::shared_ptr<sprite_batch>;
+struct sprite_batch_info;
+struct sprite;
+
 /******************************    Render Pass    *****************************/
 class render_pass;
 using render_pass_ptr = std::shared_ptr<render_pass>;
@@ -540,6 +735,29 @@ extern const swapchain_present_modes MAILBOX;
 extern const swapchain_present_modes MAILBOX_OR_FIFO;
 } // namespace swapchain_present_modes_config
 
+/******************************    Descriptor    ******************************/
+class descriptor_set_layout;
+using descriptor_set_layout_ptr = std::shared_ptr<descriptor_set_layout>;
+struct descriptor_set_layout_info;
+namespace descriptor_set_layout_info_config {
+extern const descriptor_set_layout_info DEFAULT;
+} // namespace descriptor_set_layout_info_config
+
+/// @brief Descriptor set layout bindings.
+using descriptor_set_layout_bindings =
+    std::vector<vk::DescriptorSetLayoutBinding>;
+namespace descriptor_set_layout_bindings_config {
+extern const descriptor_set_layout_bindings NONE;
+} // namespace descriptor_set_layout_bindings_config
+
+/// @brief Flags for each binding of a descriptor set layout. Either empty or
+/// the same length as the bindings.
+using descriptor_set_layout_binding_flags =
+    std::vector<vk::DescriptorBindingFlags>;
+namespace descriptor_set_layout_binding_flags_config {
+extern const descriptor_set_layout_binding_flags NONE;
+} // namespace descriptor_set_layout_binding_flags_config
+
 /*******************************    Pipeline    *******************************/
 class pipeline;
 using pipeline_ptr = std::shared_ptr<pipeline>;
@@ -547,6 +765,10 @@ struct pipeline_info;
 namespace pipeline_info_config {
 extern const pipeline_info DEFAULT;
 } // namespace pipeline_info_config
+struct compute_pipeline_info;
+namespace compute_pipeline_info_config {
+extern const compute_pipeline_info DEFAULT;
+} // namespace compute_pipeline_info_config
 
 /// @brief Collection of shaders for creating a pipeline.
 struct pipeline_shaders;
@@ -561,6 +783,25 @@ extern const pipeline_dynamic_states VIEWPORT;
 extern const pipeline_dynamic_states VIEWPORT_AND_SCISSOR;
 } // namespace pipeline_dynamic_states_config
 
+/// @brief Push constant ranges declared in the pipeline layout.
+using pipeline_push_constant_ranges = std::vector<vk::PushConstantRange>;
+namespace pipeline_push_constant_ranges_config {
+extern const pipeline_push_constant_ranges NONE;
+} // namespace pipeline_push_constant_ranges_config
+
+/// @brief Descriptor set layouts declared in the pipeline layout.
+using pipeline_descriptor_set_layouts = std::vector<descriptor_set_layout_ptr>;
+namespace pipeline_descriptor_set_layouts_config {
+extern const pipeline_descriptor_set_layouts NONE;
+} // namespace pipeline_descriptor_set_layouts_config
+
+/// @brief Blending of the color attachment.
+using pipeline_color_blend = vk::PipelineColorBlendAttachmentState;
+namespace pipeline_color_blend_config {
+extern const pipeline_color_blend DISABLED;
+extern const pipeline_color_blend ALPHA;
+} // namespace pipeline_color_blend_config
+
 /********************************    Device    ********************************/
 class device;
 using device_ptr = std::shared_ptr<device>;
@@ -588,8 +829,26 @@ extern const device_selection_function MINIMUM_FOR_PRESENTATION;
 using device_features = vk::PhysicalDeviceFeatures;
 namespace device_features_config {
 extern const device_features NONE;
+extern const device_features MULTI_DRAW_INDIRECT;
 } // namespace device_features_config
 
+/// @brief Vulkan 1.2 physical device features. Chained to the logical device
+/// creation info when any feature is enabled.
+using device_vulkan12_features = vk::PhysicalDeviceVulkan12Features;
+namespace device_vulkan12_features_config {
+extern const device_vulkan12_features NONE;
+extern const device_vulkan12_features DRAW_INDIRECT_COUNT;
+} // namespace device_vulkan12_features_config
+
+/// @brief Bindless resource configuration. When enabled, the device owns one
+/// update-after-bind descriptor set containing large arrays of sampled images
+/// and storage buffers that shaders index with values from push constants.
+struct device_bindless_info;
+namespace device_bindless_info_config {
+extern const device_bindless_info DISABLED;
+extern const device_bindless_info ENABLED;
+} // namespace device_bindless_info_config
+
 /// @brief Logical device extensions.
 /// @todo Consider naming this device_selection_extensions (if possible to
 /// select for logical device extensions during physical device selection).
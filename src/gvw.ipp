@@ -8,7 +8,10 @@
  */
 
 // Standard includes
+#include <deque>
 #include <fstream>
+#include <cstring>
+#include <type_traits>
 
 // Local includes
 #include "gvw.hpp"
@@ -67,6 +70,15 @@ struct coordinate
         return (this->x != Coordinate.x) || (this->y != Coordinate.y);
     }
 
+    coordinate<T> operator+(const coordinate<T>& Coordinate) const
+    {
+        return { this->x + Coordinate.x, this->y + Coordinate.y };
+    }
+    coordinate<T> operator-(const coordinate<T>& Coordinate) const
+    {
+        return { this->x - Coordinate.x, this->y - Coordinate.y };
+    }
+
     coordinate<T> operator+(T Type) const
     {
         return { this->x + Type, this->y + Type };
@@ -170,6 +182,15 @@ struct area
         return (this->width != Area.width) || (this->height != Area.height);
     }
 
+    area<T> operator+(const area<T>& Area) const
+    {
+        return { this->width + Area.width, this->height + Area.height };
+    }
+    area<T> operator-(const area<T>& Area) const
+    {
+        return { this->width - Area.width, this->height - Area.height };
+    }
+
     area<T> operator+(T Type) const
     {
         return { this->width + Type, this->height + Type };
@@ -372,23 +393,54 @@ enum struct creation_hint_opengl_profile
     // NOLINTEND
 };
 
+class file_view : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::file_view_public_constructor;
+
+    friend file_view_ptr MapFile(const char* Path);
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    file_view(const char* Path);
+
+  public:
+    ~file_view();
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Page aligned, so any type can be read in place.
+    const std::byte* data = nullptr;
+    size_t size = 0;
+    bool opened = false;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns the contents of the file. Valid while the view exists.
+    [[nodiscard]] std::span<const std::byte> GetData() const;
+};
+
 template<typename T>
 std::vector<T> ReadFile(const char* Absolute_Path)
 {
-    std::ifstream file(Absolute_Path, std::ios::ate | std::ios::binary);
-    if (!file.is_open()) {
-        ErrorCallback(("Failed to open shader file: \"" +
-                       static_cast<std::string>(Absolute_Path) + "\"")
-                          .c_str());
+    file_view_ptr file = MapFile(Absolute_Path);
+    if (file == nullptr) {
+        return {};
+    }
+    std::span<const std::byte> fileData = file->GetData();
+    std::vector<T> buffer(fileData.size() / sizeof(T));
+    if (buffer.empty()) {
+        return buffer;
     }
-    size_t fileSize = file.tellg();
-    std::vector<T> charBuffer;
-    charBuffer.resize(fileSize);
-    file.seekg(0);
-    file.read(charBuffer.data(),
-              static_cast<std::streamsize>(charBuffer.size()));
-    file.close();
-    return charBuffer;
+    std::memcpy(buffer.data(), fileData.data(), buffer.size() * sizeof(T));
+    return buffer;
 }
 
 struct image_file_info
@@ -399,7 +451,9 @@ struct image_file_info
 
 struct image_memory_info
 {
-    std::vector<uint8_t> data;
+    /// @brief Encoded image data. It is not copied, so it must remain valid
+    /// until the image is decoded.
+    std::span<const uint8_t> data = {};
     int requestedColorComponentsPerPixel = 4;
 };
 
@@ -407,8 +461,10 @@ class image
 {
     friend internal::image_public_constructor;
 
+    friend instance;
     friend cursor;
     friend window;
+    friend device;
 
     ////////////////////////////////////////////////////////////////////////////
     ///                Constructors, Operators, and Destructor               ///
@@ -432,6 +488,18 @@ class image
     uint8_t* data = nullptr;
     area<int> size = { 0, 0 };
     int colorComponentsPerPixel = 0;
+    /// @brief The number of color components per pixel in `data`. This is the
+    /// requested number unless no specific number was requested.
+    int dataColorComponentsPerPixel = 0;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Decodes an encoded image into `data`. Leaves `data` NULL on
+    /// failure.
+    void Decode(std::span<const uint8_t> Encoded_Data,
+                int Requested_Color_Components_Per_Pixel);
 
   public:
     ////////////////////////////////////////////////////////////////////////////
@@ -447,6 +515,76 @@ image_ptr CreateImage(const T& Info)
     return std::make_shared<internal::image_public_constructor>(Info);
 }
 
+template<typename T>
+std::future<image_ptr> CreateImageAsync(const T& Info)
+{
+    return internal::GetThreadPool().Submit(
+        [Info]() { return CreateImage(Info); });
+}
+
+template<typename T>
+std::vector<image_ptr> CreateImages(const std::vector<T>& Infos)
+{
+    std::vector<std::future<image_ptr>> futures;
+    futures.reserve(Infos.size());
+    for (const auto& info : Infos) {
+        futures.emplace_back(CreateImageAsync(info));
+    }
+
+    std::vector<image_ptr> images;
+    images.reserve(futures.size());
+    for (auto& future : futures) {
+        images.emplace_back(future.get());
+    }
+    return images;
+}
+
+class archive : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::archive_public_constructor;
+
+    friend archive_ptr OpenArchive(const char* Path);
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    archive(const char* Path);
+
+  public:
+    ~archive() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    file_view_ptr file;
+    /// @brief The table of contents. Every entry was bounds checked when the
+    /// archive was opened.
+    std::span<const internal::archive_entry> table;
+    bool valid = false;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns the contents of an entry, or nothing if the archive does
+    /// not contain it. Valid while the archive exists.
+    [[nodiscard]] std::optional<std::span<const std::byte>> Find(
+        std::string_view Name) const;
+
+    /// @brief Returns the words of a SPIR-V entry for `shader_info::spirv`.
+    [[nodiscard]] std::span<const uint32_t> GetSpirV(
+        std::string_view Name) const;
+
+    /// @brief Decodes an image entry without copying it.
+    [[nodiscard]] image_ptr DecodeImage(
+        std::string_view Name,
+        int Requested_Color_Components_Per_Pixel = 4) const;
+};
+
 struct instance_creation_hints_info
 {
     // Shared hints.
@@ -524,6 +662,25 @@ struct instance_joystick_event
     int event;
 };
 
+struct instance_joystick_state
+{
+    /// @brief Every other member is zero if the joystick is not connected.
+    bool connected = false;
+
+    /// @brief Values beyond the capacity of the arrays are not recorded.
+    size_t axisCount = 0;
+    std::array<float, internal::JOYSTICK_AXIS_CAPACITY> axes = {};
+    size_t buttonCount = 0;
+    std::array<unsigned char, internal::JOYSTICK_BUTTON_CAPACITY> buttons = {};
+    size_t hatCount = 0;
+    std::array<unsigned char, internal::JOYSTICK_HAT_CAPACITY> hats = {};
+
+    /// @brief Whether `gamepad` holds the state of the joystick mapped to a
+    /// standard gamepad layout.
+    bool isGamepad = false;
+    GLFWgamepadstate gamepad = {};
+};
+
 enum struct window_key
 {
     // NOLINTBEGIN
@@ -663,6 +820,90 @@ enum struct window_key_action
     // NOLINTEND
 };
 
+enum struct window_event_coalescing
+{
+    // NOLINTBEGIN
+
+    /// @brief Every event is kept in the order it was received.
+    eKeepAll = int(internal::event_coalescing::KEEP_ALL),
+
+    /// @brief Only the most recent event is kept.
+    eKeepLatest = int(internal::event_coalescing::KEEP_LATEST),
+
+    /// @brief A single event holding the change since the last drain is kept.
+    /// Scroll offsets are summed. Positions and sizes report the difference
+    /// between the latest value and the value at the last drain.
+    eAccumulate = int(internal::event_coalescing::ACCUMULATE)
+
+    // NOLINTEND
+};
+
+enum struct window_event_overflow
+{
+    // NOLINTBEGIN
+
+    /// @brief The new event is dropped.
+    eDropNewest = int(internal::event_overflow::DROP_NEWEST),
+
+    /// @brief The oldest event that has not been drained is dropped. Events
+    /// returned by the latest drain are never overwritten. While the buffer is
+    /// copied, the new event is dropped instead.
+    eDropOldest = int(internal::event_overflow::DROP_OLDEST),
+
+    /// @brief Event polling waits until the buffer is drained.
+    /// @warning Only use this if the buffer is drained by a thread other than
+    /// the one polling for events. Otherwise polling never returns.
+    eBlock = int(internal::event_overflow::BLOCK)
+
+    // NOLINTEND
+};
+
+struct window_event_buffer_info
+{
+    /// @brief Rounded up to a power of two.
+    size_t capacity = 256; // NOLINT
+    window_event_overflow overflow = window_event_overflow::eDropNewest;
+};
+
+struct window_event_buffers_info
+{
+    window_event_buffer_info key;
+    window_event_buffer_info character;
+    window_event_buffer_info cursorPosition;
+    window_event_buffer_info cursorEnter;
+    window_event_buffer_info mouseButton;
+    window_event_buffer_info scroll;
+    window_event_buffer_info fileDrop;
+    window_event_buffer_info size;
+    window_event_buffer_info framebufferSize;
+    window_event_buffer_info contentScale;
+    window_event_buffer_info position;
+    window_event_buffer_info iconify;
+    window_event_buffer_info maximize;
+    window_event_buffer_info focus;
+    /// @brief The unified event queue.
+    window_event_buffer_info queue = { .capacity = 1024 }; // NOLINT
+};
+
+struct window_event_drop_counts
+{
+    size_t key;
+    size_t character;
+    size_t cursorPosition;
+    size_t cursorEnter;
+    size_t mouseButton;
+    size_t scroll;
+    size_t fileDrop;
+    size_t size;
+    size_t framebufferSize;
+    size_t contentScale;
+    size_t position;
+    size_t iconify;
+    size_t maximize;
+    size_t focus;
+    size_t queue;
+};
+
 struct window_event_callbacks
 {
     window_key_event_callback keyCallback =
@@ -697,6 +938,47 @@ struct window_event_callbacks
         window_focus_event_callback_config::NONE;
     window_refresh_event_callback refreshCallback =
         window_refresh_event_callback_config::NONE;
+
+    // Coalescing of high frequency events. Only applies to the event buffers,
+    // not the unified event queue.
+    window_event_coalescing cursorPositionCoalescing =
+        window_event_coalescing::eKeepAll;
+    window_event_coalescing scrollCoalescing =
+        window_event_coalescing::eKeepAll;
+    window_event_coalescing sizeCoalescing = window_event_coalescing::eKeepAll;
+    window_event_coalescing framebufferSizeCoalescing =
+        window_event_coalescing::eKeepAll;
+};
+
+/// @brief A callable invoked with the window that received an event and the
+/// event, if it carries any data. Capture user context in the callable.
+/// Callables of up to four pointers in size are stored without allocating.
+template<typename... Event>
+using window_event_handler =
+    internal::small_function<void(window&, const Event&...)>;
+
+/// @remark Handlers run on the thread that polls for events and may call the
+/// functions of any window, such as `ShouldClose`.
+/// @warning Handlers must not poll for events, destroy a window, or set the
+/// handlers of the window that received the event.
+struct window_event_handlers
+{
+    window_event_handler<window_key_event> key;
+    window_event_handler<window_character_event> character;
+    window_event_handler<window_cursor_position_event> cursorPosition;
+    window_event_handler<window_cursor_enter_event> cursorEnter;
+    window_event_handler<window_mouse_button_event> mouseButton;
+    window_event_handler<window_scroll_event> scroll;
+    window_event_handler<window_file_drop_event> fileDrop;
+    window_event_handler<> close;
+    window_event_handler<window_size_event> size;
+    window_event_handler<window_framebuffer_size_event> framebufferSize;
+    window_event_handler<window_content_scale_event> contentScale;
+    window_event_handler<window_position_event> position;
+    window_event_handler<window_iconify_event> iconify;
+    window_event_handler<window_maximize_event> maximize;
+    window_event_handler<window_focus_event> focus;
+    window_event_handler<> refresh;
 };
 
 struct window_creation_hints_info
@@ -835,8 +1117,161 @@ struct window_mouse_button_event
 
 struct window_file_drop_event
 {
-    int count;
-    const char** paths;
+    /// @brief Copies of the dropped paths. They stay valid until the buffer the
+    /// event was read from is drained or cleared again.
+    std::span<const std::string_view> paths;
+};
+
+enum struct window_event_type
+{
+    eKey,
+    eCharacter,
+    eCursorPosition,
+    eCursorEnter,
+    eMouseButton,
+    eScroll,
+    eFileDrop,
+    eClose,
+    eSize,
+    eFramebufferSize,
+    eContentScale,
+    ePosition,
+    eIconify,
+    eMaximize,
+    eFocus,
+    eRefresh
+};
+
+struct window_event
+{
+    window_event_type type = {};
+    window_event_time time = {};
+
+    /// @brief The member matching `type`. Close and refresh events have no
+    /// data.
+    union
+    {
+        window_key_event key;
+        window_character_event character;
+        window_cursor_position_event cursorPosition;
+        window_cursor_enter_event cursorEnter;
+        window_mouse_button_event mouseButton;
+        window_scroll_event scroll;
+        window_file_drop_event fileDrop;
+        window_size_event size;
+        window_framebuffer_size_event framebufferSize;
+        window_content_scale_event contentScale;
+        window_position_event position;
+        window_iconify_event iconify;
+        window_maximize_event maximize;
+        window_focus_event focus;
+    };
+};
+
+/// @brief Events returned by the drain functions of `gvw::window`. Nothing is
+/// copied, so the events are only valid until the next drain or clear of the
+/// same buffer.
+template<typename T>
+using window_events = internal::spsc_ring_view<T>;
+
+class event_recorder : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::event_recorder_public_constructor;
+
+    friend event_recorder_ptr CreateEventRecorder(const char* Path);
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    event_recorder(const char* Path);
+
+  public:
+    ~event_recorder() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    std::ofstream file;
+    /// @brief The time of the first recorded event. Recorded times are relative
+    /// to it.
+    std::optional<window_event_time> start;
+    bool opened = false;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Appends an event to the recording. Record events in the order
+    /// they were received.
+    void Record(const window_event& Event);
+
+    /// @brief Appends every event returned by a drain to the recording.
+    void Record(window_events<window_event> Events);
+
+    /// @brief Writes buffered events to the file. Also done on destruction.
+    void Flush();
+};
+
+class event_replayer : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::event_replayer_public_constructor;
+
+    friend event_replayer_ptr OpenEventRecording(const char* Path);
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    event_replayer(const char* Path);
+
+  public:
+    ~event_replayer() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief The recorded events. Their times are measured from the first
+    /// event, and the paths of file drop events point into `pathViews`.
+    std::vector<window_event> events;
+    std::deque<std::string> paths;
+    std::vector<std::string_view> pathViews;
+
+    /// @brief The index of the next event to inject.
+    size_t next = 0;
+    /// @brief When `Replay` was first called since the last rewind.
+    std::optional<std::chrono::steady_clock::time_point> start;
+    bool valid = false;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Injects every event that was recorded no later than the time
+    /// since the first call, multiplied by `Speed`, and returns how many were
+    /// injected. Call once per frame.
+    size_t Replay(window& Window, double Speed = 1.0);
+
+    /// @brief Injects every event that was recorded no later than `Time` after
+    /// the first event and returns how many were injected. Advancing `Time` by
+    /// a fixed step per frame replays the same events on the same frames every
+    /// run, regardless of how long frames take.
+    size_t ReplayUntil(window& Window, std::chrono::nanoseconds Time);
+
+    /// @brief Returns whether every event has been injected.
+    [[nodiscard]] bool Finished() const;
+
+    /// @brief Returns the number of recorded events.
+    [[nodiscard]] size_t Size() const;
+
+    /// @brief Starts replaying from the first event again.
+    void Rewind();
 };
 
 enum struct cursor_standard_shape
@@ -863,6 +1298,7 @@ class cursor : internal::uncopyable_unmovable // NOLINT
 {
     friend internal::cursor_public_constructor;
 
+    friend instance;
     friend window;
 
     ////////////////////////////////////////////////////////////////////////////
@@ -890,14 +1326,21 @@ class cursor : internal::uncopyable_unmovable // NOLINT
     ////////////////////////////////////////////////////////////////////////////
 
     GLFWcursor* handle = nullptr;
+
+    /// @brief The image of a custom cursor. Used to deduplicate cursors
+    /// without keeping the image alive.
+    std::weak_ptr<const image> source;
 };
 
 struct shader_info
 {
     const char* name = "";
     const char* code = "";
+    std::span<const uint32_t> spirv = {};
     vk::ShaderStageFlagBits stage = {};
     const char* entryPoint = "main";
+    const shader_specialization_constants& specializationConstants =
+        shader_specialization_constants_config::NONE;
 };
 
 class shader
@@ -908,6 +1351,7 @@ class shader
     vk::UniqueShaderModule handle;
     vk::ShaderStageFlagBits stage;
     const char* entryPoint = "main";
+    std::shared_ptr<const internal::shader_specialization> specialization;
 };
 
 struct vertex_shader_info
@@ -927,6 +1371,7 @@ class vertex_shader
     vk::UniqueShaderModule handle;
     vk::ShaderStageFlagBits stage;
     const char* entryPoint;
+    std::shared_ptr<const internal::shader_specialization> specialization;
     std::vector<vk::VertexInputBindingDescription> bindingDescriptions;
     std::vector<vk::VertexInputAttributeDescription> attributeDescriptions;
 };
@@ -944,6 +1389,23 @@ class fragment_shader
     vk::UniqueShaderModule handle;
     vk::ShaderStageFlagBits stage;
     const char* entryPoint;
+    std::shared_ptr<const internal::shader_specialization> specialization;
+};
+
+struct compute_shader_info
+{
+    shader_info general = { .stage = vk::ShaderStageFlagBits::eCompute };
+};
+
+class compute_shader
+{
+    friend internal::compute_shader_public_constructor;
+
+  public:
+    vk::UniqueShaderModule handle;
+    vk::ShaderStageFlagBits stage;
+    const char* entryPoint;
+    std::shared_ptr<const internal::shader_specialization> specialization;
 };
 
 struct buffer_info
@@ -963,6 +1425,164 @@ class buffer
     vk::DeviceSize size = {};
     vk::UniqueBuffer handle;
     vk::UniqueDeviceMemory memory;
+    vk::MemoryPropertyFlags memoryProperties = {};
+    /// @brief Host pointer to the memory if it stays mapped, as it does for
+    /// the buffer of a buffer ring.
+    void* persistentMapping = nullptr;
+};
+
+struct buffer_ring_info
+{
+    vk::DeviceSize sizeInBytesPerFrame = 65536; // NOLINT
+    /// @brief Must be greater than the number of frames in flight.
+    uint32_t frameCount = 2;
+    vk::BufferUsageFlags usage = vk::BufferUsageFlagBits::eUniformBuffer;
+};
+
+struct buffer_ring_allocation
+{
+    /// @brief Host pointer to the allocated bytes.
+    void* data = nullptr;
+    /// @brief Byte offset from the start of the ring. Pass this as the dynamic
+    /// offset when binding a descriptor set.
+    uint32_t offset = 0;
+};
+
+class buffer_ring : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::buffer_ring_public_constructor;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    buffer_ring(buffer_ptr Buffer,
+                void* Mapped_Memory,
+                vk::DeviceSize Alignment,
+                vk::DeviceSize Region_Size,
+                uint32_t Frame_Count);
+
+  public:
+    // The destructor is public to allow explicit destruction.
+    ~buffer_ring() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    buffer_ptr ringBuffer;
+    std::byte* mappedMemory;
+    vk::DeviceSize alignment;
+    vk::DeviceSize regionSize;
+    uint32_t frameCount;
+    uint32_t frameIndex = 0;
+    vk::DeviceSize regionOffset = 0;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Returns the underlying buffer.
+    [[nodiscard]] buffer_ptr GetBuffer() const;
+
+    /// @brief Returns the size of the region reserved for each frame.
+    [[nodiscard]] vk::DeviceSize GetRegionSize() const;
+
+    /// @brief Allocates bytes from the region of the current frame. The offset
+    /// of the allocation is aligned to the minimum offset alignment required
+    /// by the device for the usage of the buffer. Returns std::nullopt if the
+    /// region of the current frame is full.
+    [[nodiscard]] std::optional<buffer_ring_allocation> Allocate(
+        vk::DeviceSize Size_In_Bytes);
+
+    /// @brief Allocates space for a value and copies it into the ring. Returns
+    /// std::nullopt if the region of the current frame is full.
+    template<typename T>
+    std::optional<buffer_ring_allocation> Write(const T& Value);
+
+    /// @brief Moves to the region of the next frame. Call this once per frame.
+    void NextFrame();
+};
+
+template<typename T>
+std::optional<buffer_ring_allocation> buffer_ring::Write(const T& Value)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    std::optional<buffer_ring_allocation> allocation =
+        this->Allocate(sizeof(T));
+    if (allocation.has_value()) {
+        std::memcpy(allocation->data, &Value, sizeof(T));
+    }
+    return allocation;
+}
+
+struct texture_info
+{
+    /// @brief Must have four color components per pixel.
+    image_ptr image = nullptr;
+    /// @brief BGRA formats are swizzled from the RGBA image during the upload.
+    vk::Format format = vk::Format::eR8G8B8A8Srgb;
+    vk::Filter magFilter = vk::Filter::eLinear;
+    vk::Filter minFilter = vk::Filter::eLinear;
+    vk::SamplerAddressMode addressMode = vk::SamplerAddressMode::eRepeat;
+    /// @brief Generates the full mip chain on the GPU as part of the upload.
+    bool generateMipmaps = false;
+    /// @brief Multiplies colors by their alpha during the upload. sRGB formats
+    /// are multiplied in linear space.
+    bool premultiplyAlpha = false;
+};
+
+class texture
+{
+    friend internal::texture_public_constructor;
+
+  public:
+    /// @brief The image this texture was uploaded from. Used to deduplicate
+    /// uploads without keeping the pixel data alive.
+    std::weak_ptr<const image> source;
+    vk::Extent2D extent = {};
+    vk::Format format = vk::Format::eUndefined;
+    uint32_t mipLevels = 1;
+    vk::UniqueImage handle;
+    vk::UniqueDeviceMemory memory;
+    vk::UniqueImageView view;
+    vk::UniqueSampler sampler;
+};
+
+struct atlas_info
+{
+    /// @brief Must have four color components per pixel.
+    std::vector<image_ptr> images = {};
+    /// @brief Width and height of each page in pixels.
+    uint32_t pageSize = 2048; // NOLINT
+    /// @brief Pixels around each image filled with copies of its edge pixels
+    /// so that filtering does not bleed between neighboring images.
+    uint32_t padding = 1;
+    vk::Format format = vk::Format::eR8G8B8A8Srgb;
+    vk::Filter filter = vk::Filter::eLinear;
+    bool generateMipmaps = false;
+    bool premultiplyAlpha = false;
+};
+
+struct atlas_region
+{
+    /// @brief Index of the page containing the image.
+    uint32_t page = 0;
+    /// @brief Texture coordinates of the top left and bottom right corners.
+    xy uvMin = {};
+    xy uvMax = {};
+};
+
+class atlas
+{
+    friend internal::atlas_public_constructor;
+
+  public:
+    std::vector<texture_ptr> pages;
+    /// @brief One region per image in the order they were given.
+    std::vector<atlas_region> regions;
 };
 
 struct render_pass_info
@@ -1010,6 +1630,24 @@ class swapchain
     std::vector<vk::UniqueFramebuffer> swapchainFramebuffers;
 };
 
+struct descriptor_set_layout_info
+{
+    const descriptor_set_layout_bindings& bindings =
+        descriptor_set_layout_bindings_config::NONE;
+    const descriptor_set_layout_binding_flags& bindingFlags =
+        descriptor_set_layout_binding_flags_config::NONE;
+    vk::DescriptorSetLayoutCreateFlags flags = {};
+};
+
+class descriptor_set_layout
+{
+    friend internal::descriptor_set_layout_public_constructor;
+
+  public:
+    vk::UniqueDescriptorSetLayout handle;
+    descriptor_set_layout_bindings bindings;
+};
+
 struct pipeline_shaders
 {
     vertex_shader_ptr vertex;
@@ -1026,7 +1664,22 @@ struct pipeline_info
     const pipeline_shaders& shaders = pipeline_shaders_config::NONE;
     const pipeline_dynamic_states& dynamicStates =
         pipeline_dynamic_states_config::VIEWPORT_AND_SCISSOR;
-    vk::RenderPass renderPass;
+    const pipeline_push_constant_ranges& pushConstantRanges =
+        pipeline_push_constant_ranges_config::NONE;
+    const pipeline_descriptor_set_layouts& descriptorSetLayouts =
+        pipeline_descriptor_set_layouts_config::NONE;
+    render_pass_ptr renderPass = nullptr;
+    const pipeline_color_blend& colorBlend =
+        pipeline_color_blend_config::DISABLED;
+};
+
+struct compute_pipeline_info
+{
+    compute_shader_ptr shader = nullptr;
+    const pipeline_push_constant_ranges& pushConstantRanges =
+        pipeline_push_constant_ranges_config::NONE;
+    const pipeline_descriptor_set_layouts& descriptorSetLayouts =
+        pipeline_descriptor_set_layouts_config::NONE;
 };
 
 class pipeline
@@ -1036,6 +1689,13 @@ class pipeline
   public:
     vk::UniquePipelineLayout layout;
     vk::UniquePipeline handle;
+    pipeline_push_constant_ranges pushConstantRanges;
+    pipeline_descriptor_set_layouts descriptorSetLayouts;
+    // The pipeline cache of the device identifies pipelines by the handles of
+    // these objects, so they must outlive the pipeline.
+    pipeline_shaders shaders;
+    compute_shader_ptr computeShader;
+    render_pass_ptr renderPass;
 };
 
 struct device_selection_queue_family_info
@@ -1051,6 +1711,13 @@ struct device_selection_parameter
     swapchain_present_modes presentModes;
 };
 
+struct device_bindless_info
+{
+    bool enable = false;
+    uint32_t maxSampledImages = 4096;  // NOLINT
+    uint32_t maxStorageBuffers = 1024; // NOLINT
+};
+
 struct device_selection_info
 {
     device_selection_function selectPhysicalDevicesAndQueues =
@@ -1059,8 +1726,11 @@ struct device_selection_info
         swapchain_surface_formats_config::STANDARD;
     swapchain_present_modes presentModes = swapchain_present_modes_config::FIFO;
     device_features physicalDeviceFeatures = device_features_config::NONE;
+    device_vulkan12_features vulkan12Features =
+        device_vulkan12_features_config::NONE;
     const device_extensions& logicalDeviceExtensions =
         device_extensions_config::SWAPCHAIN;
+    device_bindless_info bindless = device_bindless_info_config::DISABLED;
 };
 
 struct device_info
@@ -1074,6 +1744,9 @@ struct device_info
         device_extensions_config::SWAPCHAIN;
     device_features physicalDeviceFeatures = device_features_config::NONE;
     std::vector<device_selection_queue_family_info> queueFamilyInfos = {};
+    device_vulkan12_features vulkan12Features =
+        device_vulkan12_features_config::NONE;
+    device_bindless_info bindless = device_bindless_info_config::DISABLED;
 };
 
 struct window_info
@@ -1086,6 +1759,8 @@ struct window_info
         window_creation_hints_config::DEFAULT;
     const window_event_callbacks& eventCallbacks =
         window_event_callbacks_config::NONE;
+    const window_event_buffers_info& eventBuffers =
+        window_event_buffers_info_config::DEFAULT;
     const device_selection_info& deviceSelectionInfo =
         device_selection_info_config::DEFAULT;
     device_ptr device = nullptr;
@@ -1093,7 +1768,140 @@ struct window_info
     const pipeline_shaders& shaders = pipeline_shaders_config::NONE;
     const std::vector<gvw::xy_rgb>& staticVertices = NO_VERTICES;
     vk::DeviceSize sizeOfDynamicDataVerticesInBytes = 0;
+    const pipeline_push_constant_ranges& pushConstantRanges =
+        pipeline_push_constant_ranges_config::NONE;
+    const pipeline_descriptor_set_layouts& descriptorSetLayouts =
+        pipeline_descriptor_set_layouts_config::NONE;
+    pipeline_ptr pipeline = nullptr;
+};
+
+struct window_draw_info
+{
+    uint32_t vertexCount = 0;
+    uint32_t instanceCount = 1;
+    uint32_t firstVertex = 0;
+    uint32_t firstInstance = 0;
+    vk::ShaderStageFlags pushConstantStages = {};
+    uint32_t pushConstantOffset = 0;
+    /// @brief Bytes written with vkCmdPushConstants before the draw. Use
+    /// `std::as_bytes(std::span(&Value, 1))` to pass a single struct.
+    std::span<const std::byte> pushConstants = {};
+    /// @brief Descriptor sets bound starting at `firstSet` before the draw.
+    uint32_t firstSet = 0;
+    std::span<const vk::DescriptorSet> descriptorSets = {};
+    std::span<const uint32_t> dynamicOffsets = {};
+    /// @brief Replaces the vertex buffer of the window for this draw.
+    buffer_ptr vertexBuffer = nullptr;
+    vk::DeviceSize vertexBufferOffset = 0;
+    /// @brief Makes the draw indexed. `vertexCount` is then the index count.
+    buffer_ptr indexBuffer = nullptr;
+    vk::DeviceSize indexBufferOffset = 0;
+    vk::IndexType indexType = vk::IndexType::eUint32;
+    uint32_t firstIndex = 0;
+    int32_t vertexOffset = 0;
+    /// @brief Makes the draw indirect. `drawCount` commands are read from this
+    /// buffer and the direct draw parameters above are ignored. A `drawCount`
+    /// above one requires the `multiDrawIndirect` feature.
+    buffer_ptr indirectBuffer = nullptr;
+    vk::DeviceSize indirectBufferOffset = 0;
+    uint32_t drawCount = 1;
+    /// @brief Zero selects the size of one (indexed) indirect command.
+    uint32_t indirectStride = 0;
+    /// @brief Reads the draw count from this buffer, limited to `drawCount`.
+    /// Requires the `drawIndirectCount` Vulkan 1.2 feature.
+    buffer_ptr countBuffer = nullptr;
+    vk::DeviceSize countBufferOffset = 0;
+    /// @brief Replaces the pipeline of the window for this draw. It must be
+    /// compatible with the render pass of the window.
+    pipeline_ptr pipeline = nullptr;
+};
+
+struct window_dispatch_info
+{
+    /// @brief A pipeline created with `gvw::device::CreateComputePipeline`.
     pipeline_ptr pipeline = nullptr;
+    uint32_t firstSet = 0;
+    std::span<const vk::DescriptorSet> descriptorSets = {};
+    std::span<const uint32_t> dynamicOffsets = {};
+    vk::ShaderStageFlags pushConstantStages =
+        vk::ShaderStageFlagBits::eCompute;
+    uint32_t pushConstantOffset = 0;
+    std::span<const std::byte> pushConstants = {};
+    uint32_t groupCountX = 1;
+    uint32_t groupCountY = 1;
+    uint32_t groupCountZ = 1;
+};
+
+struct sprite
+{
+    /// @brief Top left corner in normalized device coordinates.
+    xy position = {};
+    xy size = {};
+    /// @brief Index of a region of the atlas.
+    uint32_t region = 0;
+    rgba color = { 1.0F, 1.0F, 1.0F, 1.0F };
+};
+
+struct sprite_batch_info
+{
+    atlas_ptr atlas = nullptr;
+    /// @brief Maximum number of sprites per frame.
+    uint32_t maxSprites = 4096; // NOLINT
+};
+
+class sprite_batch : internal::uncopyable_unmovable // NOLINT
+{
+    friend internal::sprite_batch_public_constructor;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    sprite_batch(atlas_ptr Atlas,
+                 pipeline_ptr Pipeline,
+                 descriptor_set_layout_ptr Descriptor_Set_Layout,
+                 std::vector<vk::DescriptorSet> Page_Descriptor_Sets,
+                 buffer_ring_ptr Instance_Ring,
+                 uint32_t Max_Sprites);
+
+  public:
+    // The destructor is public to allow explicit destruction.
+    ~sprite_batch() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    atlas_ptr spriteAtlas;
+    pipeline_ptr spritePipeline;
+    descriptor_set_layout_ptr descriptorSetLayout;
+    /// @brief One descriptor set per page of the atlas.
+    std::vector<vk::DescriptorSet> pageDescriptorSets;
+    buffer_ring_ptr instanceRing;
+    uint32_t maxSprites;
+    uint32_t spriteCount = 0;
+    /// @brief Instances of the current frame grouped by page.
+    std::vector<std::vector<internal::sprite_instance>> pageInstances;
+    std::vector<window_draw_info> draws;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Adds a sprite to the current frame. Returns false if the batch
+    /// is full or the region does not exist.
+    bool Add(const sprite& Sprite);
+
+    /// @brief Removes every sprite from the current frame.
+    void Clear();
+
+    /// @brief Writes the sprites of the current frame to the instance ring,
+    /// clears the batch, and returns one instanced draw per page with sprites.
+    /// Pass the draws to `gvw::window::DrawFrame`.
+    /// @remark The draws are valid until the next call.
+    [[nodiscard]] const std::vector<window_draw_info>& Build();
 };
 
 } // namespace gvw
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 
+// Standard includes
+#include <map>
+#include <tuple>
+
 // Local includes
 #include "gvw.hpp"
 #include "gvw.ipp"
@@ -22,6 +26,24 @@ struct instance::impl
     vk::DispatchLoaderDynamic vulkanDispatchLoaderDynamic;
     vk::UniqueHandle<vk::DebugUtilsMessengerEXT, vk::DispatchLoaderDynamic>
         vulkanDebugUtilsMessenger;
+
+    /// @brief Live images decoded from files keyed by path and the requested
+    /// number of color components. Loading an identical image returns the
+    /// existing one.
+    std::map<std::pair<std::string, int>, std::weak_ptr<image>> images;
+    std::mutex imagesMutex;
+
+    /// @brief Live cursors. Custom cursors are keyed by their image and
+    /// hotspot.
+    std::map<cursor_standard_shape, std::weak_ptr<cursor>> standardCursors;
+    std::map<std::tuple<const image*, int, int>, std::weak_ptr<cursor>>
+        customCursors;
+    std::mutex cursorsMutex;
+
+    /// @brief Live window icons keyed by their image.
+    std::map<const image*, std::weak_ptr<const internal::window_icon>>
+        windowIcons;
+    std::mutex windowIconsMutex;
 };
 
 } // namespace gvw
\ No newline at end of file
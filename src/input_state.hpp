@@ -0,0 +1,133 @@
+#pragma once
+
+/**
+ * @file input_state.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief A lock-free table of which keys or buttons are held down. Must not
+ * depend on anything but the standard library.
+ * @date 2023-10-09
+ */
+
+// Standard includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace gvw::internal {
+
+/// @brief Tracks whether each of `COUNT` inputs is down and whether it was
+/// pressed or released since the last call to `NextFrame`. Queries are atomic,
+/// so any number of threads may query the table while event callbacks update
+/// it.
+/// @warning Only one thread may call `Set` and only one thread may call
+/// `NextFrame` at a time.
+template<size_t COUNT>
+class input_state
+{
+    static constexpr size_t WORD_BITS = 64;
+    static constexpr size_t WORD_COUNT = (COUNT + WORD_BITS - 1) / WORD_BITS;
+    using bits = std::array<std::atomic<uint64_t>, WORD_COUNT>;
+
+    bits down = {};
+    bits pressed = {};
+    bits released = {};
+
+    /// @brief Inputs released in sticky mode that have not been queried since.
+    mutable bits stuck = {};
+    std::atomic<bool> sticky = false;
+
+    static bool Test(const bits& Bits, size_t Index)
+    {
+        if (Index >= COUNT) {
+            return false;
+        }
+        uint64_t word =
+            Bits[Index / WORD_BITS].load(std::memory_order_acquire);
+        return (word & (uint64_t{ 1 } << (Index % WORD_BITS))) != 0;
+    }
+
+  public:
+    /// @brief Records that an input went down or up. Out of range inputs are
+    /// ignored.
+    /// @remark Producer only.
+    void Set(size_t Index, bool Down)
+    {
+        if (Index >= COUNT) {
+            return;
+        }
+        size_t word = Index / WORD_BITS;
+        uint64_t bit = uint64_t{ 1 } << (Index % WORD_BITS);
+        if (Down) {
+            if ((this->down[word].fetch_or(bit, std::memory_order_acq_rel) &
+                 bit) == 0) {
+                this->pressed[word].fetch_or(bit, std::memory_order_release);
+            }
+            if (Test(this->stuck, Index)) {
+                this->stuck[word].fetch_and(~bit, std::memory_order_acq_rel);
+            }
+        } else {
+            if ((this->down[word].fetch_and(~bit, std::memory_order_acq_rel) &
+                 bit) != 0) {
+                this->released[word].fetch_or(bit, std::memory_order_release);
+                if (this->sticky.load(std::memory_order_relaxed)) {
+                    this->stuck[word].fetch_or(bit, std::memory_order_release);
+                }
+            }
+        }
+    }
+
+    /// @brief In sticky mode, an input released since it was last queried is
+    /// reported as down by exactly one query, like GLFW's sticky keys.
+    [[nodiscard]] bool IsDown(size_t Index) const
+    {
+        if (Test(this->down, Index)) {
+            return true;
+        }
+        if (!Test(this->stuck, Index)) {
+            return false;
+        }
+        uint64_t bit = uint64_t{ 1 } << (Index % WORD_BITS);
+        return (this->stuck[Index / WORD_BITS].fetch_and(
+                    ~bit, std::memory_order_acq_rel) &
+                bit) != 0;
+    }
+
+    /// @brief Enables or disables sticky mode. Disabling it forgets inputs
+    /// that were released but not yet queried.
+    void SetSticky(bool Sticky)
+    {
+        this->sticky.store(Sticky, std::memory_order_relaxed);
+        if (!Sticky) {
+            for (auto& word : this->stuck) {
+                word.store(0, std::memory_order_release);
+            }
+        }
+    }
+
+    /// @brief Also true if the input was pressed and released again within the
+    /// same frame.
+    [[nodiscard]] bool WasPressed(size_t Index) const
+    {
+        return Test(this->pressed, Index);
+    }
+
+    /// @brief Also true if the input was released and pressed again within the
+    /// same frame.
+    [[nodiscard]] bool WasReleased(size_t Index) const
+    {
+        return Test(this->released, Index);
+    }
+
+    /// @brief Forgets which inputs were pressed or released. Inputs that are
+    /// down stay down.
+    void NextFrame()
+    {
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            this->pressed[i].store(0, std::memory_order_release);
+            this->released[i].store(0, std::memory_order_release);
+        }
+    }
+};
+
+} // namespace gvw::internal
@@ -285,6 +285,7 @@ void instance::PollEvents()
     }
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
     glfwPollEvents();
+    internal::PollJoysticks();
 }
 
 void instance::WaitThenPollEvents()
@@ -294,6 +295,7 @@ void instance::WaitThenPollEvents()
     }
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
     glfwWaitEvents();
+    internal::PollJoysticks();
 }
 
 void instance::WaitThenPollEvents(double Timeout)
@@ -303,6 +305,7 @@ void instance::WaitThenPollEvents(double Timeout)
     }
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
     glfwWaitEventsTimeout(Timeout);
+    internal::PollJoysticks();
 }
 
 void instance::PostEmptyEvent()
@@ -416,6 +419,8 @@ std::vector<device_ptr> instance::SelectPhysicalDevices(
             Device_Info.logicalDeviceExtensions;
         physicalDeviceInfo.physicalDeviceFeatures =
             Device_Info.physicalDeviceFeatures;
+        physicalDeviceInfo.vulkan12Features = Device_Info.vulkan12Features;
+        physicalDeviceInfo.bindless = Device_Info.bindless;
 
         logicalDevices.emplace_back(
             std::make_shared<internal::device_public_constructor>(
@@ -465,13 +470,70 @@ std::vector<gvw::monitor_ptr> instance::GetAllMonitors()
     return monitors;
 }
 
+image_ptr instance::CreateImage(const image_file_info& File_Info)
+{
+    if (File_Info.path == nullptr) {
+        return gvw::CreateImage(File_Info);
+    }
+
+    std::pair<std::string, int> key = {
+        File_Info.path, File_Info.requestedColorComponentsPerPixel
+    };
+    {
+        std::scoped_lock lock(this->pImpl->imagesMutex);
+        auto cachedImage = this->pImpl->images.find(key);
+        if (cachedImage != this->pImpl->images.end()) {
+            image_ptr existingImage = cachedImage->second.lock();
+            if (existingImage != nullptr) {
+                return existingImage;
+            }
+        }
+    }
+
+    // Decode without holding the lock so that other images can be loaded
+    // concurrently.
+    image_ptr newImage = gvw::CreateImage(File_Info);
+    if (newImage->data == nullptr) {
+        return newImage;
+    }
+
+    std::scoped_lock lock(this->pImpl->imagesMutex);
+    std::erase_if(this->pImpl->images,
+                  [](const auto& Image) { return Image.second.expired(); });
+    // Another thread may have loaded the same image in the meantime.
+    auto [cachedImage, inserted] =
+        this->pImpl->images.try_emplace(std::move(key), newImage);
+    if (!inserted) {
+        image_ptr existingImage = cachedImage->second.lock();
+        if (existingImage != nullptr) {
+            return existingImage;
+        }
+        cachedImage->second = newImage;
+    }
+    return newImage;
+}
+
 cursor_ptr instance::CreateCursor(cursor_standard_shape Cursor_Standard_Shape)
 {
     if (this->GlfwNotInitialized(static_cast<const char*>(__func__))) {
         return nullptr;
     }
-    return std::make_shared<internal::cursor_public_constructor>(
-        Cursor_Standard_Shape);
+
+    // Creating a cursor takes `GLFW_MUTEX`, which event handlers already hold,
+    // so it is taken first to keep the order of the locks the same.
+    std::scoped_lock lock(internal::global::GLFW_MUTEX,
+                          this->pImpl->cursorsMutex);
+    std::weak_ptr<cursor>& cachedCursor =
+        this->pImpl->standardCursors[Cursor_Standard_Shape];
+    cursor_ptr existingCursor = cachedCursor.lock();
+    if (existingCursor != nullptr) {
+        return existingCursor;
+    }
+    cursor_ptr newCursor =
+        std::make_shared<internal::cursor_public_constructor>(
+            Cursor_Standard_Shape);
+    cachedCursor = newCursor;
+    return newCursor;
 }
 
 cursor_ptr instance::CreateCursor(
@@ -480,8 +542,76 @@ cursor_ptr instance::CreateCursor(
     if (this->GlfwNotInitialized(static_cast<const char*>(__func__))) {
         return nullptr;
     }
-    return std::make_shared<internal::cursor_public_constructor>(
-        Cursor_Custom_Shape_Info);
+    if (Cursor_Custom_Shape_Info.image == nullptr ||
+        Cursor_Custom_Shape_Info.image->data == nullptr) {
+        ErrorCallback("Cannot create a cursor from an image without data.");
+        return nullptr;
+    }
+
+    std::tuple<const image*, int, int> key = {
+        Cursor_Custom_Shape_Info.image.get(),
+        Cursor_Custom_Shape_Info.hotspot.x,
+        Cursor_Custom_Shape_Info.hotspot.y
+    };
+    std::scoped_lock lock(internal::global::GLFW_MUTEX,
+                          this->pImpl->cursorsMutex);
+    auto cachedCursor = this->pImpl->customCursors.find(key);
+    if (cachedCursor != this->pImpl->customCursors.end()) {
+        cursor_ptr existingCursor = cachedCursor->second.lock();
+        if (existingCursor != nullptr &&
+            existingCursor->source.lock() == Cursor_Custom_Shape_Info.image) {
+            return existingCursor;
+        }
+    }
+
+    cursor_ptr newCursor =
+        std::make_shared<internal::cursor_public_constructor>(
+            Cursor_Custom_Shape_Info);
+    std::erase_if(this->pImpl->customCursors,
+                  [](const auto& Cursor) { return Cursor.second.expired(); });
+    this->pImpl->customCursors.insert_or_assign(std::move(key), newCursor);
+    return newCursor;
+}
+
+std::shared_ptr<const internal::window_icon> instance::GetWindowIcon(
+    const image_ptr& Icon)
+{
+    std::scoped_lock lock(this->pImpl->windowIconsMutex);
+    auto cachedIcon = this->pImpl->windowIcons.find(Icon.get());
+    if (cachedIcon != this->pImpl->windowIcons.end()) {
+        std::shared_ptr<const internal::window_icon> existingIcon =
+            cachedIcon->second.lock();
+        if (existingIcon != nullptr) {
+            return existingIcon;
+        }
+    }
+
+    auto newIcon = std::make_shared<internal::window_icon>();
+    newIcon->source = Icon;
+    uint8_t* pixels = Icon->data;
+    // GLFW only accepts RGBA pixels.
+    if (Icon->dataColorComponentsPerPixel != 4) {
+        const size_t pixelCount =
+            static_cast<size_t>(Icon->size.width) * Icon->size.height;
+        newIcon->convertedPixels.resize(pixelCount * 4);
+        internal::ExpandToRgba(
+            { Icon->data,
+              pixelCount *
+                  static_cast<size_t>(Icon->dataColorComponentsPerPixel) },
+            Icon->dataColorComponentsPerPixel,
+            newIcon->convertedPixels);
+        pixels = newIcon->convertedPixels.data();
+    }
+    newIcon->glfwImage = { .width = Icon->size.width,
+                           .height = Icon->size.height,
+                           .pixels = pixels };
+
+    std::erase_if(this->pImpl->windowIcons,
+                  [](const auto& Window_Icon) {
+                      return Window_Icon.second.expired();
+                  });
+    this->pImpl->windowIcons.insert_or_assign(Icon.get(), newIcon);
+    return newIcon;
 }
 
 const char* instance::GetClipboard()
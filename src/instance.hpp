@@ -85,6 +85,11 @@ class instance : internal::uncopyable_unmovable // NOLINT
     [[nodiscard]] bool SelectedLayersNotSupported(
         const std::string& Function_Name) const;
 
+    /// @brief Returns the window icon made from an image, creating it if
+    /// necessary.
+    [[nodiscard]] std::shared_ptr<const internal::window_icon> GetWindowIcon(
+        const image_ptr& Icon);
+
   public:
     ////////////////////////////////////////////////////////////////////////////
     ///                        Public Member Functions                       ///
@@ -95,11 +100,12 @@ class instance : internal::uncopyable_unmovable // NOLINT
         instance_joystick_event_callback Joystick_Event_Callback =
             instance_joystick_event_callback_config::NONE);
 
-    /// @brief Polls events for all windows.
+    /// @brief Polls events for all windows and records the state of every
+    /// joystick.
     void PollEvents();
 
     /// @brief Waits until a window event is received, then polls events for all
-    /// windows.
+    /// windows and records the state of every joystick.
     void WaitThenPollEvents();
 
     /// @brief Waits until either the timeout (measured in milliseconds) expires
@@ -131,6 +137,12 @@ class instance : internal::uncopyable_unmovable // NOLINT
     /// @brief Returns all monitors.
     [[nodiscard]] std::vector<monitor_ptr> GetAllMonitors();
 
+    /// @brief Decodes an image file. Loading the same path with the same
+    /// number of requested color components again returns the existing image.
+    [[nodiscard]] image_ptr CreateImage(const image_file_info& File_Info);
+
+    /// @brief Creates a cursor. Requesting an identical cursor again returns
+    /// the existing one.
     [[nodiscard]] cursor_ptr CreateCursor(
         cursor_standard_shape Cursor_Standard_Shape =
             cursor_standard_shape::eArrow);
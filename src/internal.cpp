@@ -1,5 +1,12 @@
+// Standard includes
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <thread>
+
 // Local includes
 #include "gvw.ipp"
+#include "window.hpp"
 
 namespace gvw::internal {
 
@@ -34,10 +41,487 @@ void* GetUserPointer(GLFWwindow* Window)
     return glfwGetWindowUserPointer(Window);
 }
 
+void AppendToEventQueue(GLFWwindow* Window, window_event Event)
+{
+    Event.time = std::chrono::steady_clock::now();
+    static_cast<window*>(GetUserPointer(Window))->eventQueue.Push(Event);
+}
+
+namespace {
+
+/// @brief Copies the paths into the pending arena and pushes the event made
+/// from the copies. The arena lock is released while waiting for a full buffer
+/// to be drained, and the paths are copied again if the wait spans a drain.
+/// The copies of a dropped event are released right away.
+template<typename Event, typename Make_Event>
+void AppendFileDrop(file_drop_paths& File_Drop_Paths,
+                    event_stream<Event>& Events,
+                    std::span<const char* const> Paths,
+                    const Make_Event& Make)
+{
+    std::unique_lock lock(File_Drop_Paths.mutex);
+    uint64_t generation = File_Drop_Paths.generation;
+    string_arena::mark beforeCopy = File_Drop_Paths.pending.GetMark();
+    Event event = Make(File_Drop_Paths.pending.Copy(Paths));
+    string_arena::mark afterCopy = File_Drop_Paths.pending.GetMark();
+    while (!Events.TryPush(event)) {
+        if (Events.GetOverflow() != event_overflow::BLOCK) {
+            // Paths copied by another thread after these must be kept.
+            if (File_Drop_Paths.pending.GetMark() == afterCopy) {
+                File_Drop_Paths.pending.Rewind(beforeCopy);
+            }
+            return;
+        }
+        lock.unlock();
+        std::this_thread::yield();
+        lock.lock();
+        if (File_Drop_Paths.generation != generation) {
+            generation = File_Drop_Paths.generation;
+            beforeCopy = File_Drop_Paths.pending.GetMark();
+            event = Make(File_Drop_Paths.pending.Copy(Paths));
+            afterCopy = File_Drop_Paths.pending.GetMark();
+        }
+    }
+}
+
+} // namespace
+
+void AppendToFileDropEventBuffer(GLFWwindow* Window,
+                                 int Count,
+                                 const char** Paths)
+{
+    auto* windowPtr = static_cast<window*>(GetUserPointer(Window));
+    AppendFileDrop(windowPtr->fileDropPaths,
+                   windowPtr->fileDropEvents,
+                   { Paths, size_t(Count) },
+                   [](std::span<const std::string_view> Copies) {
+                       return window_file_drop_event{ Copies };
+                   });
+}
+
+void AppendFileDropToEventQueue(GLFWwindow* Window,
+                                int Count,
+                                const char** Paths)
+{
+    auto* windowPtr = static_cast<window*>(GetUserPointer(Window));
+    window_event_time time = std::chrono::steady_clock::now();
+    AppendFileDrop(windowPtr->eventQueuePaths,
+                   windowPtr->eventQueue,
+                   { Paths, size_t(Count) },
+                   [time](std::span<const std::string_view> Copies) {
+                       window_event event = {};
+                       event.type = window_event_type::eFileDrop;
+                       event.time = time;
+                       event.fileDrop = { Copies };
+                       return event;
+                   });
+}
+
+void CallFileDropEventHandler(GLFWwindow* Window,
+                              int Count,
+                              const char** Paths)
+{
+    auto* windowPtr = static_cast<window*>(GetUserPointer(Window));
+    if (!windowPtr->eventHandlers.fileDrop) {
+        return;
+    }
+    window_file_drop_event event = { windowPtr->handlerPaths.Copy(
+        { Paths, size_t(Count) }) };
+    windowPtr->eventHandlers.fileDrop(*windowPtr, event);
+    windowPtr->handlerPaths.Reset();
+}
+
+namespace {
+
+/// @brief Written by `PollJoysticks` and read by any thread.
+std::array<seqlock<instance_joystick_state>, GLFW_JOYSTICK_LAST + 1>
+    JOYSTICK_STATES; // NOLINT
+
+/// @brief Which joysticks were connected during the last poll. Only accessed
+/// while `GLFW_MUTEX` is locked.
+std::array<bool, GLFW_JOYSTICK_LAST + 1> JOYSTICKS_CONNECTED = {}; // NOLINT
+
+} // namespace
+
+void PollJoysticks()
+{
+    for (int jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST; ++jid) {
+        instance_joystick_state state = {};
+        state.connected = (glfwJoystickPresent(jid) == GLFW_TRUE);
+        if (!state.connected && !JOYSTICKS_CONNECTED.at(size_t(jid))) {
+            continue;
+        }
+        JOYSTICKS_CONNECTED.at(size_t(jid)) = state.connected;
+
+        if (state.connected) {
+            int count = 0;
+            const float* axes = glfwGetJoystickAxes(jid, &count);
+            state.axisCount = std::min(size_t(count), state.axes.size());
+            std::copy_n(axes, state.axisCount, state.axes.begin());
+
+            const unsigned char* buttons = glfwGetJoystickButtons(jid, &count);
+            state.buttonCount = std::min(size_t(count), state.buttons.size());
+            std::copy_n(buttons, state.buttonCount, state.buttons.begin());
+
+            const unsigned char* hats = glfwGetJoystickHats(jid, &count);
+            state.hatCount = std::min(size_t(count), state.hats.size());
+            std::copy_n(hats, state.hatCount, state.hats.begin());
+
+            state.isGamepad =
+                (glfwGetGamepadState(jid, &state.gamepad) == GLFW_TRUE);
+        }
+        JOYSTICK_STATES.at(size_t(jid)).Store(state);
+    }
+}
+
+instance_joystick_state LoadJoystickState(int JID)
+{
+    if (JID < GLFW_JOYSTICK_1 || JID > GLFW_JOYSTICK_LAST) {
+        return {};
+    }
+    return JOYSTICK_STATES.at(size_t(JID)).Load();
+}
+
+void KeyCallback(
+    GLFWwindow* Window, int Key, int Scancode, int Action, int Mods)
+{
+    auto* windowPtr = static_cast<window*>(GetUserPointer(Window));
+    // Unknown keys are negative and wrap to an out of range index.
+    windowPtr->keyStates.Set(size_t(Key), Action != GLFW_RELEASE);
+    if (windowPtr->eventCallbacks.keyCallback != nullptr) {
+        windowPtr->eventCallbacks.keyCallback(
+            Window, Key, Scancode, Action, Mods);
+    }
+}
+
+void MouseButtonCallback(GLFWwindow* Window, int Button, int Action, int Mods)
+{
+    auto* windowPtr = static_cast<window*>(GetUserPointer(Window));
+    windowPtr->mouseButtonStates.Set(size_t(Button), Action != GLFW_RELEASE);
+    if (windowPtr->eventCallbacks.mouseButtonCallback != nullptr) {
+        windowPtr->eventCallbacks.mouseButtonCallback(
+            Window, Button, Action, Mods);
+    }
+}
+
+/********************************    Shader    ********************************/
+
+std::shared_ptr<const shader_specialization> CreateShaderSpecialization(
+    const shader_specialization_constants& Specialization_Constants)
+{
+    if (Specialization_Constants.empty()) {
+        return nullptr;
+    }
+
+    auto specialization = std::make_shared<shader_specialization>();
+    specialization->mapEntries.reserve(Specialization_Constants.size());
+    specialization->data.reserve(Specialization_Constants.size() *
+                                 sizeof(uint32_t));
+    for (const auto& [constantId, value] : Specialization_Constants) {
+        // Booleans are 32-bit in SPIR-V.
+        std::array<std::byte, sizeof(uint32_t)> bytes = std::visit(
+            [](auto Value) {
+                if constexpr (std::is_same_v<decltype(Value), bool>) {
+                    return std::bit_cast<std::array<std::byte, 4>>(
+                        static_cast<VkBool32>(Value ? VK_TRUE : VK_FALSE));
+                } else {
+                    return std::bit_cast<std::array<std::byte, 4>>(Value);
+                }
+            },
+            value);
+        specialization->mapEntries.emplace_back(vk::SpecializationMapEntry{
+            .constantID = constantId,
+            .offset = static_cast<uint32_t>(specialization->data.size()),
+            .size = bytes.size() });
+        specialization->data.insert(
+            specialization->data.end(), bytes.begin(), bytes.end());
+    }
+    specialization->info = {
+        .mapEntryCount =
+            static_cast<uint32_t>(specialization->mapEntries.size()),
+        .pMapEntries = specialization->mapEntries.data(),
+        .dataSize = specialization->data.size(),
+        .pData = specialization->data.data()
+    };
+    return specialization;
+}
+
+/********************************    Texture    *******************************/
+
+void RecordImageLayoutTransition(vk::CommandBuffer Command_Buffer,
+                                 vk::Image Image,
+                                 uint32_t Base_Mip_Level,
+                                 uint32_t Level_Count,
+                                 vk::ImageLayout Old_Layout,
+                                 vk::ImageLayout New_Layout,
+                                 vk::AccessFlags Src_Access_Mask,
+                                 vk::AccessFlags Dst_Access_Mask,
+                                 vk::PipelineStageFlags Src_Stage_Mask,
+                                 vk::PipelineStageFlags Dst_Stage_Mask)
+{
+    vk::ImageMemoryBarrier imageMemoryBarrier = {
+        .srcAccessMask = Src_Access_Mask,
+        .dstAccessMask = Dst_Access_Mask,
+        .oldLayout = Old_Layout,
+        .newLayout = New_Layout,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = Image,
+        .subresourceRange = { .aspectMask = vk::ImageAspectFlagBits::eColor,
+                              .baseMipLevel = Base_Mip_Level,
+                              .levelCount = Level_Count,
+                              .baseArrayLayer = 0,
+                              .layerCount = 1 }
+    };
+    Command_Buffer.pipelineBarrier(
+        Src_Stage_Mask, Dst_Stage_Mask, {}, {}, {}, imageMemoryBarrier);
+}
+
+/*******************************    Pipeline    *******************************/
+
+bool PushConstantsFitLayout(
+    const pipeline_push_constant_ranges& Push_Constant_Ranges,
+    vk::ShaderStageFlags Stages,
+    uint32_t Offset,
+    size_t Size)
+{
+    if (!Stages || Size == 0 || Offset % 4 != 0 || Size % 4 != 0) {
+        return false;
+    }
+    uint64_t end = uint64_t{ Offset } + Size;
+    uint64_t layoutEnd = 0;
+    for (const auto& pushConstantRange : Push_Constant_Ranges) {
+        layoutEnd = std::max(layoutEnd,
+                             uint64_t{ pushConstantRange.offset } +
+                                 pushConstantRange.size);
+    }
+    if (end > layoutEnd) {
+        return false;
+    }
+
+    // Each written word must be in a range of every written stage, and every
+    // range that contains it must only include written stages.
+    for (uint64_t word = Offset; word < end; word += 4) {
+        vk::ShaderStageFlags wordStages = {};
+        for (const auto& pushConstantRange : Push_Constant_Ranges) {
+            if (pushConstantRange.offset <= word &&
+                word < uint64_t{ pushConstantRange.offset } +
+                           pushConstantRange.size) {
+                wordStages |= pushConstantRange.stageFlags;
+            }
+        }
+        if (wordStages != Stages) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AppendLayoutToPipelineKey(
+    std::vector<uint64_t>& Key,
+    const pipeline_push_constant_ranges& Push_Constant_Ranges,
+    const pipeline_descriptor_set_layouts& Descriptor_Set_Layouts)
+{
+    Key.emplace_back(Push_Constant_Ranges.size());
+    for (const auto& pushConstantRange : Push_Constant_Ranges) {
+        Key.emplace_back(static_cast<uint64_t>(
+            static_cast<VkShaderStageFlags>(pushConstantRange.stageFlags)));
+        Key.emplace_back(pushConstantRange.offset);
+        Key.emplace_back(pushConstantRange.size);
+    }
+
+    Key.emplace_back(Descriptor_Set_Layouts.size());
+    for (const auto& descriptorSetLayout : Descriptor_Set_Layouts) {
+        Key.emplace_back(std::hash<vk::DescriptorSetLayout>{}(
+            descriptorSetLayout->handle.get()));
+    }
+}
+
+/********************************    Device    ********************************/
+
+std::optional<uint32_t> index_allocator::Allocate()
+{
+    if (!this->released.empty()) {
+        uint32_t index = this->released.back();
+        this->released.pop_back();
+        this->used[index] = true;
+        return index;
+    }
+    if (this->next < this->capacity) {
+        this->used.push_back(true);
+        return this->next++;
+    }
+    return std::nullopt;
+}
+
+bool index_allocator::Release(uint32_t Index)
+{
+    if (Index >= this->next || !this->used[Index]) {
+        return false;
+    }
+    this->used[Index] = false;
+    this->released.emplace_back(Index);
+    return true;
+}
+
+std::optional<coordinate<uint32_t>> skyline_packer::Insert(uint32_t Width,
+                                                           uint32_t Height)
+{
+    if (Width == 0 || Height == 0 || Width > this->width ||
+        Height > this->height) {
+        return std::nullopt;
+    }
+
+    // Find the segment where the rectangle rests lowest. Ties go to the
+    // narrowest segment to leave wide gaps for wide rectangles.
+    std::optional<size_t> bestIndex;
+    uint32_t bestY = 0;
+    uint32_t bestSegmentWidth = 0;
+    for (size_t i = 0; i < this->skyline.size(); ++i) {
+        if (this->skyline[i].x + Width > this->width) {
+            break;
+        }
+        // The rectangle rests on the highest segment beneath it.
+        uint32_t y = 0;
+        uint32_t remainingWidth = Width;
+        for (size_t j = i; remainingWidth > 0; ++j) {
+            y = std::max(y, this->skyline[j].y);
+            remainingWidth -= std::min(remainingWidth, this->skyline[j].width);
+        }
+        if (y + Height > this->height) {
+            continue;
+        }
+        if (!bestIndex.has_value() || y < bestY ||
+            (y == bestY && this->skyline[i].width < bestSegmentWidth)) {
+            bestIndex = i;
+            bestY = y;
+            bestSegmentWidth = this->skyline[i].width;
+        }
+    }
+    if (!bestIndex.has_value()) {
+        return std::nullopt;
+    }
+
+    // Raise the skyline over the rectangle and trim the segments it covers.
+    uint32_t x = this->skyline[bestIndex.value()].x;
+    this->skyline.insert(
+        this->skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex.value()),
+        { .x = x, .y = bestY + Height, .width = Width });
+    size_t next = bestIndex.value() + 1;
+    while (next < this->skyline.size() && this->skyline[next].x < x + Width) {
+        uint32_t overlap = x + Width - this->skyline[next].x;
+        if (overlap < this->skyline[next].width) {
+            this->skyline[next].x += overlap;
+            this->skyline[next].width -= overlap;
+            break;
+        }
+        this->skyline.erase(this->skyline.begin() +
+                            static_cast<std::ptrdiff_t>(next));
+    }
+
+    // Merge neighboring segments of equal height.
+    for (size_t i = 0; i + 1 < this->skyline.size();) {
+        if (this->skyline[i].y == this->skyline[i + 1].y) {
+            this->skyline[i].width += this->skyline[i + 1].width;
+            this->skyline.erase(this->skyline.begin() +
+                                static_cast<std::ptrdiff_t>(i + 1));
+        } else {
+            ++i;
+        }
+    }
+
+    return coordinate<uint32_t>{ x, bestY };
+}
+
+thread_pool::thread_pool(size_t Thread_Count)
+{
+    this->workers.reserve(Thread_Count);
+    for (size_t i = 0; i < Thread_Count; ++i) {
+        this->workers.emplace_back([this]() { this->Work(); });
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::scoped_lock lock(this->tasksMutex);
+        this->stopping = true;
+    }
+    this->tasksCondition.notify_all();
+    for (auto& worker : this->workers) {
+        worker.join();
+    }
+}
+
+namespace {
+
+/// @brief The pool that owns the calling thread, if any.
+thread_local const thread_pool* CURRENT_THREAD_POOL = nullptr; // NOLINT
+
+} // namespace
+
+void thread_pool::Work()
+{
+    CURRENT_THREAD_POOL = this;
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(this->tasksMutex);
+            this->tasksCondition.wait(lock, [this]() {
+                return this->stopping || !this->tasks.empty();
+            });
+            // Remaining tasks are finished before stopping.
+            if (this->tasks.empty()) {
+                return;
+            }
+            task = std::move(this->tasks.front());
+            this->tasks.pop_front();
+        }
+        task();
+    }
+}
+
+bool thread_pool::IsWorker() const
+{
+    return CURRENT_THREAD_POOL == this;
+}
+
+thread_pool& GetThreadPool()
+{
+    static thread_pool threadPool(
+        std::max(std::thread::hardware_concurrency(), 1U));
+    return threadPool;
+}
+
+bool Vulkan12FeaturesSupported(
+    const vk::PhysicalDeviceVulkan12Features& Requested,
+    const vk::PhysicalDeviceVulkan12Features& Available)
+{
+    // Every member after sType and pNext is a VkBool32.
+    constexpr size_t FIRST_FEATURE_OFFSET =
+        offsetof(VkPhysicalDeviceVulkan12Features, samplerMirrorClampToEdge);
+    constexpr size_t FEATURE_COUNT =
+        (sizeof(VkPhysicalDeviceVulkan12Features) - FIRST_FEATURE_OFFSET) /
+        sizeof(VkBool32);
+
+    const auto* requested = reinterpret_cast<const VkBool32*>( // NOLINT
+        reinterpret_cast<const std::byte*>(&Requested) +       // NOLINT
+        FIRST_FEATURE_OFFSET);
+    const auto* available = reinterpret_cast<const VkBool32*>( // NOLINT
+        reinterpret_cast<const std::byte*>(&Available) +       // NOLINT
+        FIRST_FEATURE_OFFSET);
+    for (size_t i = 0; i < FEATURE_COUNT; ++i) {
+        if (requested[i] == VK_TRUE && available[i] != VK_TRUE) { // NOLINT
+            return false;
+        }
+    }
+    return true;
+}
+
 /********************************    Global    ********************************/
 namespace global {
 instance_ptr GVW_INSTANCE = nullptr;
-std::mutex GLFW_MUTEX;
+std::recursive_mutex GLFW_MUTEX;
 std::mutex CONSOLE_MUTEX;
 instance_verbose_callback VERBOSE_CALLBACK = nullptr;
 std::mutex VERBOSE_CALLBACK_MUTEX;
@@ -9,9 +9,17 @@
 
 // Standard includes
 #include <concepts>
+#include <mutex>
 
 // Local includes
 #include "gvw.hpp"
+#include "archive_format.hpp"
+#include "pixel_conversion.hpp"
+#include "event_recording_format.hpp"
+#include "event_stream.hpp"
+#include "input_state.hpp"
+#include "small_function.hpp"
+#include "string_arena.hpp"
 
 namespace gvw::internal {
 
@@ -86,9 +94,15 @@ template<int_hint_function IntHintFunc,
          size_t StringHints>
 struct glfw_hints;
 
+/*******************************    File View    ******************************/
+using file_view_public_constructor = public_constructor<file_view>;
+
 /*********************************    Image    ********************************/
 using image_public_constructor = public_constructor<image>;
 
+/********************************    Archive    *******************************/
+using archive_public_constructor = public_constructor<archive>;
+
 /*****************************    GVW Instance    *****************************/
 using instance_public_constructor = public_constructor<instance>;
 
@@ -121,6 +135,8 @@ using monitor_public_constructor = public_constructor<monitor>;
 
 /********************************    Window    ********************************/
 using window_public_constructor = public_constructor<window>;
+using event_recorder_public_constructor = public_constructor<event_recorder>;
+using event_replayer_public_constructor = public_constructor<event_replayer>;
 
 enum struct window_input_mode;
 enum struct window_input_mode_cursor;
@@ -131,35 +147,216 @@ using window_input_mode_sticky_mouse_buttons = internal::glfw_bool;
 /// @warning GLFW must be initialized.
 [[nodiscard]] void* GetUserPointer(GLFWwindow* Window);
 
+/// @brief Stamps an event with the current time and appends it to the unified
+/// event queue of a window.
+/// @warning Must only be called from GLFW event callbacks.
+void AppendToEventQueue(GLFWwindow* Window, window_event Event);
+
+/// @brief Copies of the paths of the file drop events in a window event buffer.
+/// GLFW frees the paths when the file drop callback returns, so they are copied
+/// into an arena that is reset when the buffer is drained.
+struct file_drop_paths
+{
+    /// @brief Locked while copying and pushing an event and while draining or
+    /// clearing the buffer so that the arenas stay in sync with the buffer.
+    std::mutex mutex;
+
+    /// @brief Paths of events that have not been drained.
+    string_arena pending;
+
+    /// @brief Paths of events returned by the last drain.
+    string_arena drained;
+
+    /// @brief The number of drains and clears so far.
+    uint64_t generation = 0;
+
+    /// @brief Releases the paths of the events returned by the last drain.
+    /// Call before draining the buffer.
+    void Drain()
+    {
+        this->drained.Reset();
+        std::swap(this->pending, this->drained);
+        ++this->generation;
+    }
+
+    /// @brief Releases every path. Call before clearing the buffer.
+    void Clear()
+    {
+        this->pending.Reset();
+        this->drained.Reset();
+        ++this->generation;
+    }
+};
+
+/// @brief Copies dropped paths and appends a file drop event to the file drop
+/// event buffer of a window.
+/// @warning Must only be called from GLFW event callbacks.
+void AppendToFileDropEventBuffer(GLFWwindow* Window,
+                                 int Count,
+                                 const char** Paths);
+
+/// @brief Copies dropped paths and appends a file drop event to the unified
+/// event queue of a window.
+/// @warning Must only be called from GLFW event callbacks.
+void AppendFileDropToEventQueue(GLFWwindow* Window,
+                                int Count,
+                                const char** Paths);
+
+/// @brief Calls the file drop event handler of a window with copies of the
+/// dropped paths that are valid until the handler returns.
+/// @warning Must only be called from GLFW event callbacks.
+void CallFileDropEventHandler(GLFWwindow* Window,
+                              int Count,
+                              const char** Paths);
+
+/// @brief The number of keys and mouse buttons tracked by the input state
+/// tables of a window.
+inline constexpr size_t KEY_COUNT = GLFW_KEY_LAST + 1;
+inline constexpr size_t MOUSE_BUTTON_COUNT = GLFW_MOUSE_BUTTON_LAST + 1;
+
+/// @brief The number of axes, buttons, and hats recorded per joystick. Enough
+/// for every common controller, including hats reported as buttons.
+inline constexpr size_t JOYSTICK_AXIS_CAPACITY = 16;
+inline constexpr size_t JOYSTICK_BUTTON_CAPACITY = 64;
+inline constexpr size_t JOYSTICK_HAT_CAPACITY = 4;
+
+/// @brief Records the state of every joystick for `gvw::GetJoystickState`.
+/// @warning `GLFW_MUTEX` must be locked.
+void PollJoysticks();
+
+/// @brief Returns the state of a joystick recorded by the last call to
+/// `PollJoysticks` without locking.
+[[nodiscard]] instance_joystick_state LoadJoystickState(int JID);
+
+/// @brief Updates the key state table of a window and then calls the key event
+/// callback selected for the window.
+void KeyCallback(
+    GLFWwindow* Window, int Key, int Scancode, int Action, int Mods);
+
+/// @brief Updates the mouse button state table of a window and then calls the
+/// mouse button event callback selected for the window.
+void MouseButtonCallback(GLFWwindow* Window, int Button, int Action, int Mods);
+
+/// @brief Window icon pixels in the format GLFW expects. Shared by every
+/// window with the same icon.
+struct window_icon;
+
 /********************************    Cursor    ********************************/
 using cursor_public_constructor = public_constructor<cursor>;
 
 /********************************    Shader    ********************************/
 using shader_public_constructor = public_constructor<shader>;
 
+/// @brief Specialization map entries and data referenced by a
+/// `vk::SpecializationInfo`.
+struct shader_specialization;
+
+/// @brief Packs specialization constants. Returns nullptr if there are none.
+[[nodiscard]] std::shared_ptr<const shader_specialization>
+CreateShaderSpecialization(
+    const shader_specialization_constants& Specialization_Constants);
+
 using vertex_shader_public_constructor = public_constructor<vertex_shader>;
 
 using fragment_shader_public_constructor = public_constructor<fragment_shader>;
 
+using compute_shader_public_constructor = public_constructor<compute_shader>;
+
 /********************************    Buffer    ********************************/
 using buffer_public_constructor = public_constructor<buffer>;
 
+using buffer_ring_public_constructor = public_constructor<buffer_ring>;
+
+/********************************    Texture    *******************************/
+using texture_public_constructor = public_constructor<texture>;
+
+/// @brief Records a barrier that transitions mip levels of a color image from
+/// one layout to another.
+void RecordImageLayoutTransition(vk::CommandBuffer Command_Buffer,
+                                 vk::Image Image,
+                                 uint32_t Base_Mip_Level,
+                                 uint32_t Level_Count,
+                                 vk::ImageLayout Old_Layout,
+                                 vk::ImageLayout New_Layout,
+                                 vk::AccessFlags Src_Access_Mask,
+                                 vk::AccessFlags Dst_Access_Mask,
+                                 vk::PipelineStageFlags Src_Stage_Mask,
+                                 vk::PipelineStageFlags Dst_Stage_Mask);
+
 /******************************    Render Pass    *****************************/
 using render_pass_public_constructor = public_constructor<render_pass>;
 
 /*******************************    Swapchain    ******************************/
 using swapchain_public_constructor = public_constructor<swapchain>;
 
+/******************************    Descriptor    ******************************/
+using descriptor_set_layout_public_constructor =
+    public_constructor<descriptor_set_layout>;
+
 /*******************************    Pipeline    *******************************/
 using pipeline_public_constructor = public_constructor<pipeline>;
 
+/// @brief Appends a shader module, its entry point, and its specialization
+/// constants to a pipeline key. The shader module is identified by its handle,
+/// so the cached pipeline must keep the shader alive.
+template<typename T>
+void AppendShaderToPipelineKey(std::vector<uint64_t>& Key, const T& Shader);
+
+/// @brief Returns true if push constants written to `Stages` at `Offset` with
+/// `Size` bytes are allowed by the push constant ranges of a pipeline layout.
+[[nodiscard]] bool PushConstantsFitLayout(
+    const pipeline_push_constant_ranges& Push_Constant_Ranges,
+    vk::ShaderStageFlags Stages,
+    uint32_t Offset,
+    size_t Size);
+
+/// @brief Appends the push constant ranges and descriptor set layouts of a
+/// pipeline layout to a pipeline key.
+void AppendLayoutToPipelineKey(
+    std::vector<uint64_t>& Key,
+    const pipeline_push_constant_ranges& Push_Constant_Ranges,
+    const pipeline_descriptor_set_layouts& Descriptor_Set_Layouts);
+
 /********************************    Device    ********************************/
 using device_public_constructor = public_constructor<device>;
 
+/// @brief Hands out indices into a fixed size descriptor array and recycles
+/// released indices.
+class index_allocator;
+
+/// @brief Returns true if every feature enabled in `Requested` is also enabled
+/// in `Available`.
+[[nodiscard]] bool Vulkan12FeaturesSupported(
+    const vk::PhysicalDeviceVulkan12Features& Requested,
+    const vk::PhysicalDeviceVulkan12Features& Available);
+
+/*********************************    Atlas    ********************************/
+using atlas_public_constructor = public_constructor<atlas>;
+
+/// @brief Packs rectangles into a fixed size area by tracking the top edge of
+/// the packed rectangles.
+class skyline_packer;
+
+/*****************************    Sprite Batch    *****************************/
+using sprite_batch_public_constructor = public_constructor<sprite_batch>;
+
+/// @brief Per-instance vertex data of a sprite.
+struct sprite_instance;
+
+/******************************    Thread Pool    *****************************/
+/// @brief Worker threads that run submitted tasks in submission order.
+class thread_pool;
+
+/// @brief Returns the thread pool shared by asynchronous GVW functions. It has
+/// one worker per hardware thread.
+[[nodiscard]] thread_pool& GetThreadPool();
+
 /********************************    Global    ********************************/
 namespace global {
 extern instance_ptr GVW_INSTANCE;
-extern std::mutex GLFW_MUTEX;
+/// @brief Recursive so that event handlers, which run while events are polled,
+/// may call window functions.
+extern std::recursive_mutex GLFW_MUTEX;
 /// @todo Use internal::global::CONSOLE_MUTEX.
 extern std::mutex CONSOLE_MUTEX;
 extern instance_verbose_callback VERBOSE_CALLBACK;
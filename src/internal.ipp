@@ -2,6 +2,10 @@
 
 // Standard includes
 #include <list>
+#include <deque>
+#include <thread>
+#include <condition_variable>
+#include <functional>
 
 // Local includes
 #include "gvw.hpp"
@@ -312,4 +316,157 @@ enum struct window_input_mode_cursor
     // NOLINTEND
 };
 
+struct window_icon
+{
+    /// @brief Keeps the image alive while its address is used as a cache key
+    /// and while `glfwImage` points into it.
+    image_ptr source;
+    /// @brief RGBA copy of the image. Empty if the image is already RGBA.
+    std::vector<uint8_t> convertedPixels;
+    GLFWimage glfwImage;
+};
+
+struct shader_specialization
+{
+    std::vector<vk::SpecializationMapEntry> mapEntries;
+    std::vector<std::byte> data;
+    /// @brief Points into `mapEntries` and `data`.
+    vk::SpecializationInfo info;
+};
+
+template<typename T>
+void AppendShaderToPipelineKey(std::vector<uint64_t>& Key, const T& Shader)
+{
+    Key.emplace_back(std::hash<vk::ShaderModule>{}(Shader->handle.get()));
+    Key.emplace_back(static_cast<uint64_t>(Shader->stage));
+    std::string_view entryPoint = Shader->entryPoint;
+    Key.emplace_back(entryPoint.size());
+    for (char character : entryPoint) {
+        Key.emplace_back(static_cast<uint64_t>(character));
+    }
+    // Different specialization constants produce different pipelines.
+    if (Shader->specialization == nullptr) {
+        Key.emplace_back(0);
+        return;
+    }
+    Key.emplace_back(Shader->specialization->mapEntries.size());
+    for (const auto& mapEntry : Shader->specialization->mapEntries) {
+        Key.emplace_back(mapEntry.constantID);
+        Key.emplace_back(mapEntry.offset);
+        Key.emplace_back(mapEntry.size);
+    }
+    Key.emplace_back(Shader->specialization->data.size());
+    for (std::byte byte : Shader->specialization->data) {
+        Key.emplace_back(static_cast<uint64_t>(byte));
+    }
+}
+
+class index_allocator
+{
+    uint32_t capacity;
+    uint32_t next = 0;
+    std::vector<uint32_t> released;
+    /// @brief Whether each index below `next` is in use.
+    std::vector<bool> used;
+
+  public:
+    index_allocator(uint32_t Capacity = 0)
+        : capacity(Capacity)
+    {
+    }
+
+    /// @brief Returns an unused index or nothing if every index is in use.
+    [[nodiscard]] std::optional<uint32_t> Allocate();
+
+    /// @brief Returns an index to the allocator. Returns false without
+    /// changing anything if the index is not in use.
+    [[nodiscard]] bool Release(uint32_t Index);
+};
+
+class skyline_packer
+{
+    /// @brief A horizontal segment of the skyline.
+    struct segment
+    {
+        uint32_t x;
+        uint32_t y;
+        uint32_t width;
+    };
+
+    uint32_t width;
+    uint32_t height;
+    std::vector<segment> skyline;
+
+  public:
+    skyline_packer(uint32_t Width, uint32_t Height)
+        : width(Width)
+        , height(Height)
+        , skyline({ { .x = 0, .y = 0, .width = Width } })
+    {
+    }
+
+    /// @brief Places a rectangle as low as possible and returns its top left
+    /// corner, or nothing if it does not fit.
+    [[nodiscard]] std::optional<coordinate<uint32_t>> Insert(uint32_t Width,
+                                                             uint32_t Height);
+};
+
+struct sprite_instance
+{
+    xy position;
+    xy size;
+    xy uvMin;
+    xy uvMax;
+    rgba color;
+};
+
+class thread_pool : uncopyable_unmovable // NOLINT
+{
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex tasksMutex;
+    std::condition_variable tasksCondition;
+    bool stopping = false;
+
+    /// @brief Runs tasks until the pool is destroyed.
+    void Work();
+
+    /// @brief Returns true if called by one of this pool's workers.
+    [[nodiscard]] bool IsWorker() const;
+
+  public:
+    thread_pool(size_t Thread_Count);
+    ~thread_pool();
+
+    /// @brief Queues a task and returns a future for its result. Exceptions
+    /// thrown by the task are rethrown by the future.
+    /// @remark Tasks submitted by a worker run immediately on that worker, so
+    /// tasks may wait for the tasks they submit without deadlocking the pool.
+    template<typename Callable>
+    [[nodiscard]] std::future<std::invoke_result_t<Callable>> Submit(
+        Callable&& Task);
+};
+
+template<typename Callable>
+std::future<std::invoke_result_t<Callable>> thread_pool::Submit(
+    Callable&& Task)
+{
+    // std::function requires a copyable target, so the move-only task is
+    // shared.
+    auto task =
+        std::make_shared<std::packaged_task<std::invoke_result_t<Callable>()>>(
+            std::forward<Callable>(Task));
+    std::future<std::invoke_result_t<Callable>> future = task->get_future();
+    if (this->IsWorker()) {
+        (*task)();
+        return future;
+    }
+    {
+        std::scoped_lock lock(this->tasksMutex);
+        this->tasks.emplace_back([task]() { (*task)(); });
+    }
+    this->tasksCondition.notify_one();
+    return future;
+}
+
 } // namespace gvw::internal
\ No newline at end of file
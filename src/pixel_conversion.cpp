@@ -0,0 +1,672 @@
+// Standard includes
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+// Local includes
+#include "pixel_conversion.hpp"
+
+// Intrinsics
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GVW_PIXEL_CONVERSION_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+// AVX2 kernels are compiled for AVX2 regardless of the target and only called
+// if the processor supports them.
+#define GVW_PIXEL_CONVERSION_AVX2
+#define GVW_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#define GVW_PIXEL_CONVERSION_AVX2
+#define GVW_TARGET_AVX2
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define GVW_PIXEL_CONVERSION_NEON
+#include <arm_neon.h>
+#endif
+
+namespace gvw::internal {
+
+namespace {
+
+// Scalar kernels. These convert every pixel they are given and finish the
+// pixels left over by the vector kernels.
+
+void ExpandGreyToRgbaScalar(const uint8_t* Source,
+                            uint8_t* Destination,
+                            size_t Pixel_Count)
+{
+    for (size_t i = 0; i < Pixel_Count; ++i) {
+        Destination[i * 4 + 0] = Source[i];
+        Destination[i * 4 + 1] = Source[i];
+        Destination[i * 4 + 2] = Source[i];
+        Destination[i * 4 + 3] = UINT8_MAX;
+    }
+}
+
+void ExpandGreyAlphaToRgbaScalar(const uint8_t* Source,
+                                 uint8_t* Destination,
+                                 size_t Pixel_Count)
+{
+    for (size_t i = 0; i < Pixel_Count; ++i) {
+        Destination[i * 4 + 0] = Source[i * 2];
+        Destination[i * 4 + 1] = Source[i * 2];
+        Destination[i * 4 + 2] = Source[i * 2];
+        Destination[i * 4 + 3] = Source[i * 2 + 1];
+    }
+}
+
+void ExpandRgbToRgbaScalar(const uint8_t* Source,
+                           uint8_t* Destination,
+                           size_t Pixel_Count)
+{
+    for (size_t i = 0; i < Pixel_Count; ++i) {
+        Destination[i * 4 + 0] = Source[i * 3 + 0];
+        Destination[i * 4 + 1] = Source[i * 3 + 1];
+        Destination[i * 4 + 2] = Source[i * 3 + 2];
+        Destination[i * 4 + 3] = UINT8_MAX;
+    }
+}
+
+void SwizzleRgbaToBgraScalar(const uint8_t* Source,
+                             uint8_t* Destination,
+                             size_t Pixel_Count)
+{
+    for (size_t i = 0; i < Pixel_Count; ++i) {
+        uint8_t red = Source[i * 4 + 0];
+        Destination[i * 4 + 0] = Source[i * 4 + 2];
+        Destination[i * 4 + 1] = Source[i * 4 + 1];
+        Destination[i * 4 + 2] = red;
+        Destination[i * 4 + 3] = Source[i * 4 + 3];
+    }
+}
+
+/// @brief Returns Color * Alpha / 255 rounded to the nearest integer.
+constexpr uint8_t MultiplyUnorm8(uint32_t Color, uint32_t Alpha)
+{
+    uint32_t product = Color * Alpha + 128; // NOLINT
+    return static_cast<uint8_t>((product + (product >> 8)) >> 8); // NOLINT
+}
+
+void PremultiplyAlphaScalar(const uint8_t* Source,
+                            uint8_t* Destination,
+                            size_t Pixel_Count)
+{
+    for (size_t i = 0; i < Pixel_Count; ++i) {
+        uint8_t alpha = Source[i * 4 + 3];
+        Destination[i * 4 + 0] = MultiplyUnorm8(Source[i * 4 + 0], alpha);
+        Destination[i * 4 + 1] = MultiplyUnorm8(Source[i * 4 + 1], alpha);
+        Destination[i * 4 + 2] = MultiplyUnorm8(Source[i * 4 + 2], alpha);
+        Destination[i * 4 + 3] = alpha;
+    }
+}
+
+// SSE2 kernels. Each returns the number of pixels it converted.
+
+#ifdef GVW_PIXEL_CONVERSION_SSE2
+
+size_t ExpandGreyToRgbaSse2(const uint8_t* Source,
+                            uint8_t* Destination,
+                            size_t Pixel_Count)
+{
+    const __m128i opaque = _mm_set1_epi8(static_cast<char>(UINT8_MAX));
+    size_t i = 0;
+    for (; i + 16 <= Pixel_Count; i += 16) {
+        __m128i grey =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i));
+        __m128i greyGreyLow = _mm_unpacklo_epi8(grey, grey);
+        __m128i greyGreyHigh = _mm_unpackhi_epi8(grey, grey);
+        __m128i greyAlphaLow = _mm_unpacklo_epi8(grey, opaque);
+        __m128i greyAlphaHigh = _mm_unpackhi_epi8(grey, opaque);
+        auto* output = reinterpret_cast<__m128i*>(Destination + i * 4);
+        _mm_storeu_si128(output + 0,
+                         _mm_unpacklo_epi16(greyGreyLow, greyAlphaLow));
+        _mm_storeu_si128(output + 1,
+                         _mm_unpackhi_epi16(greyGreyLow, greyAlphaLow));
+        _mm_storeu_si128(output + 2,
+                         _mm_unpacklo_epi16(greyGreyHigh, greyAlphaHigh));
+        _mm_storeu_si128(output + 3,
+                         _mm_unpackhi_epi16(greyGreyHigh, greyAlphaHigh));
+    }
+    return i;
+}
+
+size_t ExpandGreyAlphaToRgbaSse2(const uint8_t* Source,
+                                 uint8_t* Destination,
+                                 size_t Pixel_Count)
+{
+    const __m128i greyMask = _mm_set1_epi16(0x00FF);
+    size_t i = 0;
+    for (; i + 8 <= Pixel_Count; i += 8) {
+        __m128i greyAlpha =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i * 2));
+        __m128i grey = _mm_and_si128(greyAlpha, greyMask);
+        __m128i greyGrey = _mm_or_si128(grey, _mm_slli_epi16(grey, 8));
+        auto* output = reinterpret_cast<__m128i*>(Destination + i * 4);
+        _mm_storeu_si128(output + 0, _mm_unpacklo_epi16(greyGrey, greyAlpha));
+        _mm_storeu_si128(output + 1, _mm_unpackhi_epi16(greyGrey, greyAlpha));
+    }
+    return i;
+}
+
+size_t ExpandRgbToRgbaSse2(const uint8_t* Source,
+                           uint8_t* Destination,
+                           size_t Pixel_Count)
+{
+    const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000));
+    size_t i = 0;
+    // Each iteration loads 16 bytes but only converts the first 12, so stop
+    // while at least 16 bytes remain.
+    for (; i + 6 <= Pixel_Count; i += 4) {
+        __m128i rgb =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i * 3));
+        // Gather the pixels starting at bytes 0, 3, 6, and 9.
+        __m128i pixels01 = _mm_unpacklo_epi32(rgb, _mm_srli_si128(rgb, 3));
+        __m128i pixels23 =
+            _mm_unpacklo_epi32(_mm_srli_si128(rgb, 6), _mm_srli_si128(rgb, 9));
+        __m128i rgba = _mm_or_si128(_mm_unpacklo_epi64(pixels01, pixels23),
+                                    opaque);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + i * 4),
+                         rgba);
+    }
+    return i;
+}
+
+size_t SwizzleRgbaToBgraSse2(const uint8_t* Source,
+                             uint8_t* Destination,
+                             size_t Pixel_Count)
+{
+    const __m128i greenAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+    size_t i = 0;
+    for (; i + 4 <= Pixel_Count; i += 4) {
+        __m128i rgba =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i * 4));
+        __m128i greenAlpha = _mm_and_si128(rgba, greenAlphaMask);
+        __m128i redBlue = _mm_andnot_si128(greenAlphaMask, rgba);
+        __m128i blueRed = _mm_or_si128(_mm_slli_epi32(redBlue, 16),
+                                       _mm_srli_epi32(redBlue, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + i * 4),
+                         _mm_or_si128(greenAlpha, blueRed));
+    }
+    return i;
+}
+
+/// @brief Premultiplies two pixels widened to 16 bits per component.
+inline __m128i PremultiplyWidePixelsSse2(__m128i Pixels)
+{
+    // Broadcast each alpha over its pixel, but multiply alpha by 255.
+    const __m128i colorMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alphaOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    __m128i alpha = _mm_shufflehi_epi16(
+        _mm_shufflelo_epi16(Pixels, _MM_SHUFFLE(3, 3, 3, 3)),
+        _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_or_si128(_mm_and_si128(alpha, colorMask), alphaOne);
+    __m128i product = _mm_add_epi16(_mm_mullo_epi16(Pixels, alpha),
+                                    _mm_set1_epi16(128));
+    return _mm_srli_epi16(
+        _mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+}
+
+size_t PremultiplyAlphaSse2(const uint8_t* Source,
+                            uint8_t* Destination,
+                            size_t Pixel_Count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= Pixel_Count; i += 4) {
+        __m128i pixels =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i * 4));
+        __m128i low =
+            PremultiplyWidePixelsSse2(_mm_unpacklo_epi8(pixels, zero));
+        __m128i high =
+            PremultiplyWidePixelsSse2(_mm_unpackhi_epi8(pixels, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + i * 4),
+                         _mm_packus_epi16(low, high));
+    }
+    return i;
+}
+
+#endif
+
+// AVX2 kernels. Each returns the number of pixels it converted.
+
+#ifdef GVW_PIXEL_CONVERSION_AVX2
+
+GVW_TARGET_AVX2 size_t ExpandRgbToRgbaAvx2(const uint8_t* Source,
+                                           uint8_t* Destination,
+                                           size_t Pixel_Count)
+{
+    const __m256i spread = _mm256_setr_epi8(
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, //
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m256i opaque = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+    size_t i = 0;
+    // The second load ends 4 bytes after the last converted pixel.
+    for (; i + 10 <= Pixel_Count; i += 8) {
+        __m128i low =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i * 3));
+        __m128i high = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(Source + i * 3 + 12));
+        __m256i rgb =
+            _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+        __m256i rgba =
+            _mm256_or_si256(_mm256_shuffle_epi8(rgb, spread), opaque);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination + i * 4),
+                            rgba);
+    }
+    return i;
+}
+
+GVW_TARGET_AVX2 size_t SwizzleRgbaToBgraAvx2(const uint8_t* Source,
+                                             uint8_t* Destination,
+                                             size_t Pixel_Count)
+{
+    const __m256i swap = _mm256_setr_epi8(
+        2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, //
+        2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    size_t i = 0;
+    for (; i + 8 <= Pixel_Count; i += 8) {
+        __m256i rgba = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(Source + i * 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination + i * 4),
+                            _mm256_shuffle_epi8(rgba, swap));
+    }
+    return i;
+}
+
+/// @brief Premultiplies four pixels widened to 16 bits per component.
+GVW_TARGET_AVX2 inline __m256i PremultiplyWidePixelsAvx2(__m256i Pixels)
+{
+    // Broadcast each alpha over its pixel, but multiply alpha by 255.
+    const __m256i colorMask = _mm256_set_epi16(
+        0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+    const __m256i alphaOne = _mm256_set_epi16(
+        255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+    __m256i alpha = _mm256_shufflehi_epi16(
+        _mm256_shufflelo_epi16(Pixels, _MM_SHUFFLE(3, 3, 3, 3)),
+        _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_or_si256(_mm256_and_si256(alpha, colorMask), alphaOne);
+    __m256i product = _mm256_add_epi16(_mm256_mullo_epi16(Pixels, alpha),
+                                       _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(
+        _mm256_add_epi16(product, _mm256_srli_epi16(product, 8)), 8);
+}
+
+GVW_TARGET_AVX2 size_t PremultiplyAlphaAvx2(const uint8_t* Source,
+                                            uint8_t* Destination,
+                                            size_t Pixel_Count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= Pixel_Count; i += 8) {
+        __m256i pixels = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(Source + i * 4));
+        // Unpacking and packing both work within 128-bit lanes, so the pixels
+        // end up back in their original order.
+        __m256i low =
+            PremultiplyWidePixelsAvx2(_mm256_unpacklo_epi8(pixels, zero));
+        __m256i high =
+            PremultiplyWidePixelsAvx2(_mm256_unpackhi_epi8(pixels, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination + i * 4),
+                            _mm256_packus_epi16(low, high));
+    }
+    return i;
+}
+
+#endif
+
+// NEON kernels. Each returns the number of pixels it converted.
+
+#ifdef GVW_PIXEL_CONVERSION_NEON
+
+size_t ExpandGreyToRgbaNeon(const uint8_t* Source,
+                            uint8_t* Destination,
+                            size_t Pixel_Count)
+{
+    const uint8x16_t opaque = vdupq_n_u8(UINT8_MAX);
+    size_t i = 0;
+    for (; i + 16 <= Pixel_Count; i += 16) {
+        uint8x16_t grey = vld1q_u8(Source + i);
+        uint8x16x4_t rgba = { { grey, grey, grey, opaque } };
+        vst4q_u8(Destination + i * 4, rgba);
+    }
+    return i;
+}
+
+size_t ExpandGreyAlphaToRgbaNeon(const uint8_t* Source,
+                                 uint8_t* Destination,
+                                 size_t Pixel_Count)
+{
+    size_t i = 0;
+    for (; i + 16 <= Pixel_Count; i += 16) {
+        uint8x16x2_t greyAlpha = vld2q_u8(Source + i * 2);
+        uint8x16x4_t rgba = { { greyAlpha.val[0],
+                                greyAlpha.val[0],
+                                greyAlpha.val[0],
+                                greyAlpha.val[1] } };
+        vst4q_u8(Destination + i * 4, rgba);
+    }
+    return i;
+}
+
+size_t ExpandRgbToRgbaNeon(const uint8_t* Source,
+                           uint8_t* Destination,
+                           size_t Pixel_Count)
+{
+    const uint8x16_t opaque = vdupq_n_u8(UINT8_MAX);
+    size_t i = 0;
+    for (; i + 16 <= Pixel_Count; i += 16) {
+        uint8x16x3_t rgb = vld3q_u8(Source + i * 3);
+        uint8x16x4_t rgba = { { rgb.val[0], rgb.val[1], rgb.val[2], opaque } };
+        vst4q_u8(Destination + i * 4, rgba);
+    }
+    return i;
+}
+
+size_t SwizzleRgbaToBgraNeon(const uint8_t* Source,
+                             uint8_t* Destination,
+                             size_t Pixel_Count)
+{
+    size_t i = 0;
+    for (; i + 16 <= Pixel_Count; i += 16) {
+        uint8x16x4_t rgba = vld4q_u8(Source + i * 4);
+        uint8x16_t red = rgba.val[0];
+        rgba.val[0] = rgba.val[2];
+        rgba.val[2] = red;
+        vst4q_u8(Destination + i * 4, rgba);
+    }
+    return i;
+}
+
+/// @brief Returns Color * Alpha / 255 rounded to the nearest integer.
+inline uint8x8_t MultiplyUnorm8Neon(uint8x8_t Color, uint8x8_t Alpha)
+{
+    uint16x8_t product =
+        vaddq_u16(vmull_u8(Color, Alpha), vdupq_n_u16(128)); // NOLINT
+    return vshrn_n_u16(vsraq_n_u16(product, product, 8), 8);
+}
+
+size_t PremultiplyAlphaNeon(const uint8_t* Source,
+                            uint8_t* Destination,
+                            size_t Pixel_Count)
+{
+    size_t i = 0;
+    for (; i + 16 <= Pixel_Count; i += 16) {
+        uint8x16x4_t pixels = vld4q_u8(Source + i * 4);
+        uint8x8_t alphaLow = vget_low_u8(pixels.val[3]);
+        uint8x8_t alphaHigh = vget_high_u8(pixels.val[3]);
+        for (int component = 0; component < 3; ++component) {
+            pixels.val[component] = vcombine_u8(
+                MultiplyUnorm8Neon(vget_low_u8(pixels.val[component]),
+                                   alphaLow),
+                MultiplyUnorm8Neon(vget_high_u8(pixels.val[component]),
+                                   alphaHigh));
+        }
+        vst4q_u8(Destination + i * 4, pixels);
+    }
+    return i;
+}
+
+#endif
+
+/// @brief Lookup tables for converting between sRGB and linear values.
+struct srgb_tables
+{
+    /// @brief Linear values of 8-bit sRGB values.
+    std::array<float, 256> toLinear;
+    /// @brief 8-bit sRGB values of linear values quantized to 12 bits.
+    std::array<uint8_t, 4096> toSrgb;
+};
+
+const srgb_tables& GetSrgbTables()
+{
+    static const srgb_tables TABLES = [] {
+        srgb_tables tables = {};
+        for (size_t i = 0; i < tables.toLinear.size(); ++i) {
+            double srgb = static_cast<double>(i) / 255.0;
+            tables.toLinear[i] = static_cast<float>(
+                (srgb <= 0.04045) ? srgb / 12.92
+                                  : std::pow((srgb + 0.055) / 1.055, 2.4));
+        }
+        for (size_t i = 0; i < tables.toSrgb.size(); ++i) {
+            double linear =
+                static_cast<double>(i) /
+                static_cast<double>(tables.toSrgb.size() - 1);
+            double srgb = (linear <= 0.0031308)
+                              ? linear * 12.92
+                              : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+            tables.toSrgb[i] =
+                static_cast<uint8_t>(std::lround(srgb * 255.0));
+        }
+        return tables;
+    }();
+    return TABLES;
+}
+
+} // namespace
+
+pixel_conversion_isa GetPixelConversionIsa()
+{
+    static const pixel_conversion_isa ISA = [] {
+#if defined(GVW_PIXEL_CONVERSION_AVX2) && \
+    (defined(__GNUC__) || defined(__clang__))
+        if (__builtin_cpu_supports("avx2")) {
+            return pixel_conversion_isa::AVX2;
+        }
+#elif defined(GVW_PIXEL_CONVERSION_AVX2)
+        return pixel_conversion_isa::AVX2;
+#endif
+#if defined(GVW_PIXEL_CONVERSION_SSE2)
+        return pixel_conversion_isa::SSE2;
+#elif defined(GVW_PIXEL_CONVERSION_NEON)
+        return pixel_conversion_isa::NEON;
+#else
+        return pixel_conversion_isa::SCALAR;
+#endif
+    }();
+    return ISA;
+}
+
+const char* GetPixelConversionIsaName(pixel_conversion_isa Isa)
+{
+    switch (Isa) {
+        case pixel_conversion_isa::SCALAR:
+            return "scalar";
+        case pixel_conversion_isa::SSE2:
+            return "SSE2";
+        case pixel_conversion_isa::AVX2:
+            return "AVX2";
+        case pixel_conversion_isa::NEON:
+            return "NEON";
+    }
+    return "unknown";
+}
+
+void ExpandGreyToRgba(std::span<const uint8_t> Source,
+                      std::span<uint8_t> Destination,
+                      pixel_conversion_isa Isa)
+{
+    const size_t pixelCount = Source.size();
+    size_t converted = 0;
+#if defined(GVW_PIXEL_CONVERSION_SSE2)
+    if (Isa != pixel_conversion_isa::SCALAR) {
+        converted = ExpandGreyToRgbaSse2(
+            Source.data(), Destination.data(), pixelCount);
+    }
+#elif defined(GVW_PIXEL_CONVERSION_NEON)
+    if (Isa != pixel_conversion_isa::SCALAR) {
+        converted = ExpandGreyToRgbaNeon(
+            Source.data(), Destination.data(), pixelCount);
+    }
+#endif
+    ExpandGreyToRgbaScalar(Source.data() + converted,
+                           Destination.data() + converted * 4,
+                           pixelCount - converted);
+}
+
+void ExpandGreyAlphaToRgba(std::span<const uint8_t> Source,
+                           std::span<uint8_t> Destination,
+                           pixel_conversion_isa Isa)
+{
+    const size_t pixelCount = Source.size() / 2;
+    size_t converted = 0;
+#if defined(GVW_PIXEL_CONVERSION_SSE2)
+    if (Isa != pixel_conversion_isa::SCALAR) {
+        converted = ExpandGreyAlphaToRgbaSse2(
+            Source.data(), Destination.data(), pixelCount);
+    }
+#elif defined(GVW_PIXEL_CONVERSION_NEON)
+    if (Isa != pixel_conversion_isa::SCALAR) {
+        converted = ExpandGreyAlphaToRgbaNeon(
+            Source.data(), Destination.data(), pixelCount);
+    }
+#endif
+    ExpandGreyAlphaToRgbaScalar(Source.data() + converted * 2,
+                                Destination.data() + converted * 4,
+                                pixelCount - converted);
+}
+
+void ExpandRgbToRgba(std::span<const uint8_t> Source,
+                     std::span<uint8_t> Destination,
+                     pixel_conversion_isa Isa)
+{
+    const size_t pixelCount = Source.size() / 3;
+    size_t converted = 0;
+#if defined(GVW_PIXEL_CONVERSION_AVX2)
+    if (Isa == pixel_conversion_isa::AVX2) {
+        converted =
+            ExpandRgbToRgbaAvx2(Source.data(), Destination.data(), pixelCount);
+    }
+#endif
+#if defined(GVW_PIXEL_CONVERSION_SSE2)
+    if (Isa == pixel_conversion_isa::SSE2 ||
+        Isa == pixel_conversion_isa::AVX2) {
+        converted += ExpandRgbToRgbaSse2(Source.data() + converted * 3,
+                                         Destination.data() + converted * 4,
+                                         pixelCount - converted);
+    }
+#elif defined(GVW_PIXEL_CONVERSION_NEON)
+    if (Isa != pixel_conversion_isa::SCALAR) {
+        converted =
+            ExpandRgbToRgbaNeon(Source.data(), Destination.data(), pixelCount);
+    }
+#endif
+    ExpandRgbToRgbaScalar(Source.data() + converted * 3,
+                          Destination.data() + converted * 4,
+                          pixelCount - converted);
+}
+
+void ExpandToRgba(std::span<const uint8_t> Source,
+                  int Color_Components_Per_Pixel,
+                  std::span<uint8_t> Destination,
+                  pixel_conversion_isa Isa)
+{
+    switch (Color_Components_Per_Pixel) {
+        case 1:
+            ExpandGreyToRgba(Source, Destination, Isa);
+            break;
+        case 2:
+            ExpandGreyAlphaToRgba(Source, Destination, Isa);
+            break;
+        case 3:
+            ExpandRgbToRgba(Source, Destination, Isa);
+            break;
+        case 4:
+            // Empty spans may hold null pointers, which memmove must not get.
+            if (!Source.empty()) {
+                std::memmove(Destination.data(), Source.data(), Source.size());
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void SwizzleRgbaToBgra(std::span<const uint8_t> Source,
+                       std::span<uint8_t> Destination,
+                       pixel_conversion_isa Isa)
+{
+    const size_t pixelCount = Source.size() / 4;
+    size_t converted = 0;
+#if defined(GVW_PIXEL_CONVERSION_AVX2)
+    if (Isa == pixel_conversion_isa::AVX2) {
+        converted = SwizzleRgbaToBgraAvx2(
+            Source.data(), Destination.data(), pixelCount);
+    }
+#endif
+#if defined(GVW_PIXEL_CONVERSION_SSE2)
+    if (Isa == pixel_conversion_isa::SSE2 ||
+        Isa == pixel_conversion_isa::AVX2) {
+        converted += SwizzleRgbaToBgraSse2(Source.data() + converted * 4,
+                                           Destination.data() + converted * 4,
+                                           pixelCount - converted);
+    }
+#elif defined(GVW_PIXEL_CONVERSION_NEON)
+    if (Isa != pixel_conversion_isa::SCALAR) {
+        converted = SwizzleRgbaToBgraNeon(
+            Source.data(), Destination.data(), pixelCount);
+    }
+#endif
+    SwizzleRgbaToBgraScalar(Source.data() + converted * 4,
+                            Destination.data() + converted * 4,
+                            pixelCount - converted);
+}
+
+void PremultiplyAlpha(std::span<const uint8_t> Source,
+                      std::span<uint8_t> Destination,
+                      pixel_conversion_isa Isa)
+{
+    const size_t pixelCount = Source.size() / 4;
+    size_t converted = 0;
+#if defined(GVW_PIXEL_CONVERSION_AVX2)
+    if (Isa == pixel_conversion_isa::AVX2) {
+        converted =
+            PremultiplyAlphaAvx2(Source.data(), Destination.data(), pixelCount);
+    }
+#endif
+#if defined(GVW_PIXEL_CONVERSION_SSE2)
+    if (Isa == pixel_conversion_isa::SSE2 ||
+        Isa == pixel_conversion_isa::AVX2) {
+        converted += PremultiplyAlphaSse2(Source.data() + converted * 4,
+                                          Destination.data() + converted * 4,
+                                          pixelCount - converted);
+    }
+#elif defined(GVW_PIXEL_CONVERSION_NEON)
+    if (Isa != pixel_conversion_isa::SCALAR) {
+        converted =
+            PremultiplyAlphaNeon(Source.data(), Destination.data(), pixelCount);
+    }
+#endif
+    PremultiplyAlphaScalar(Source.data() + converted * 4,
+                           Destination.data() + converted * 4,
+                           pixelCount - converted);
+}
+
+void PremultiplyAlphaSrgb(std::span<const uint8_t> Source,
+                          std::span<uint8_t> Destination)
+{
+    const srgb_tables& tables = GetSrgbTables();
+    const auto maxIndex = static_cast<float>(tables.toSrgb.size() - 1);
+    const size_t pixelCount = Source.size() / 4;
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const uint8_t* source = Source.data() + i * 4;
+        uint8_t* destination = Destination.data() + i * 4;
+        uint8_t alpha = source[3];
+        // Opaque pixels would only pick up rounding error.
+        if (alpha == UINT8_MAX) {
+            std::memmove(destination, source, 4);
+            continue;
+        }
+        float scale = static_cast<float>(alpha) / 255.0F * maxIndex;
+        for (size_t component = 0; component < 3; ++component) {
+            destination[component] = tables.toSrgb[static_cast<size_t>(
+                tables.toLinear[source[component]] * scale + 0.5F)];
+        }
+        destination[3] = alpha;
+    }
+}
+
+} // namespace gvw::internal
@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @file pixel_conversion.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Vectorized conversions between 8-bit pixel formats. Shared by GVW and
+ * its benchmarks, so it must not depend on anything but the standard library.
+ * @date 2023-09-30
+ */
+
+// Standard includes
+#include <cstdint>
+#include <span>
+
+namespace gvw::internal {
+
+/// @brief Instruction sets the pixel conversion kernels are written for.
+enum class pixel_conversion_isa
+{
+    SCALAR,
+    SSE2,
+    AVX2,
+    NEON
+};
+
+/// @brief Returns the best instruction set supported by this processor.
+[[nodiscard]] pixel_conversion_isa GetPixelConversionIsa();
+
+/// @brief Returns the name of an instruction set.
+[[nodiscard]] const char* GetPixelConversionIsaName(pixel_conversion_isa Isa);
+
+// Every conversion below reads whole pixels from `Source` and writes them to
+// `Destination`, which must be large enough to hold the converted pixels.
+// Conversions between formats of equal size may be done in place. Passing an
+// instruction set that this processor does not support is undefined behavior.
+
+/// @brief Expands grey pixels to opaque RGBA pixels.
+void ExpandGreyToRgba(std::span<const uint8_t> Source,
+                      std::span<uint8_t> Destination,
+                      pixel_conversion_isa Isa = GetPixelConversionIsa());
+
+/// @brief Expands grey and alpha pixels to RGBA pixels.
+void ExpandGreyAlphaToRgba(std::span<const uint8_t> Source,
+                           std::span<uint8_t> Destination,
+                           pixel_conversion_isa Isa = GetPixelConversionIsa());
+
+/// @brief Expands RGB pixels to opaque RGBA pixels.
+void ExpandRgbToRgba(std::span<const uint8_t> Source,
+                     std::span<uint8_t> Destination,
+                     pixel_conversion_isa Isa = GetPixelConversionIsa());
+
+/// @brief Expands pixels with one to four color components to RGBA pixels
+/// using the same rules as stb_image.
+void ExpandToRgba(std::span<const uint8_t> Source,
+                  int Color_Components_Per_Pixel,
+                  std::span<uint8_t> Destination,
+                  pixel_conversion_isa Isa = GetPixelConversionIsa());
+
+/// @brief Swaps the red and blue components of RGBA pixels. This converts
+/// RGBA to BGRA and BGRA to RGBA.
+void SwizzleRgbaToBgra(std::span<const uint8_t> Source,
+                       std::span<uint8_t> Destination,
+                       pixel_conversion_isa Isa = GetPixelConversionIsa());
+
+/// @brief Multiplies the color components of RGBA or BGRA pixels by their
+/// alpha component, rounding to the nearest value.
+void PremultiplyAlpha(std::span<const uint8_t> Source,
+                      std::span<uint8_t> Destination,
+                      pixel_conversion_isa Isa = GetPixelConversionIsa());
+
+/// @brief Multiplies the color components of sRGB encoded RGBA or BGRA pixels
+/// by their alpha component in linear space.
+void PremultiplyAlphaSrgb(std::span<const uint8_t> Source,
+                          std::span<uint8_t> Destination);
+
+} // namespace gvw::internal
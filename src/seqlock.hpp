@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file seqlock.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief A value written by one thread and read by any number of threads
+ * without locks. Must not depend on anything but the standard library.
+ * @date 2023-10-08
+ */
+
+// Standard includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace gvw::internal {
+
+/// @brief Readers retry instead of blocking the writer, so writing is wait-free
+/// and reading never observes a partially written value.
+/// @warning Only one thread may call `Store` at a time.
+template<typename T>
+class seqlock
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    static constexpr size_t WORD_COUNT =
+        (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    using words = std::array<uint64_t, WORD_COUNT>;
+
+    /// @brief Odd while a value is being written.
+    std::atomic<uint64_t> sequence = 0;
+
+    /// @brief The value, stored as atomic words so that concurrent reads and
+    /// writes are well defined.
+    std::array<std::atomic<uint64_t>, WORD_COUNT> value = {};
+
+  public:
+    seqlock() = default;
+    explicit seqlock(const T& Value)
+    {
+        this->Store(Value);
+    }
+
+    /// @remark Writer only.
+    void Store(const T& Value)
+    {
+        words source = {};
+        std::memcpy(source.data(), &Value, sizeof(T));
+
+        uint64_t current = this->sequence.load(std::memory_order_relaxed);
+        this->sequence.store(current + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORD_COUNT; ++i) {
+            this->value[i].store(source[i], std::memory_order_relaxed);
+        }
+        this->sequence.store(current + 2, std::memory_order_release);
+    }
+
+    [[nodiscard]] T Load() const
+    {
+        words destination = {};
+        while (true) {
+            uint64_t before = this->sequence.load(std::memory_order_acquire);
+            if ((before & 1) == 0) {
+                for (size_t i = 0; i < WORD_COUNT; ++i) {
+                    destination[i] =
+                        this->value[i].load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (this->sequence.load(std::memory_order_relaxed) == before) {
+                    break;
+                }
+            }
+            std::this_thread::yield();
+        }
+
+        T result;
+        std::memcpy(
+            static_cast<void*>(&result), destination.data(), sizeof(T));
+        return result;
+    }
+};
+
+} // namespace gvw::internal
@@ -0,0 +1,178 @@
+#pragma once
+
+/**
+ * @file small_function.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief A move-only type-erased callable that stores small callables inline.
+ * Must not depend on anything but the standard library.
+ * @date 2023-10-10
+ */
+
+// Standard includes
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace gvw::internal {
+
+template<typename Signature, size_t CAPACITY = 4 * sizeof(void*)>
+class small_function;
+
+/// @brief Like `std::function`, except that it cannot be copied and callables
+/// of up to `CAPACITY` bytes, such as lambdas capturing a few pointers, are
+/// stored without allocating. Larger callables are allocated on the heap.
+template<typename Result, typename... Args, size_t CAPACITY>
+class small_function<Result(Args...), CAPACITY>
+{
+    /// @brief Functions that know the type of the stored callable.
+    struct operations
+    {
+        Result (*invoke)(void* Storage, Args&&... Arguments);
+
+        /// @brief Moves the callable into empty storage and destroys the
+        /// original.
+        void (*relocate)(void* Destination, void* Source) noexcept;
+
+        void (*destroy)(void* Storage) noexcept;
+    };
+
+    template<typename Callable>
+    static constexpr bool STORED_INLINE =
+        sizeof(Callable) <= CAPACITY &&
+        alignof(Callable) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<Callable>;
+
+    template<typename Callable>
+    static constexpr operations INLINE_OPERATIONS = {
+        .invoke = [](void* Storage, Args&&... Arguments) -> Result {
+            return std::invoke(*static_cast<Callable*>(Storage),
+                               std::forward<Args>(Arguments)...);
+        },
+        .relocate =
+            [](void* Destination, void* Source) noexcept {
+                auto* source = static_cast<Callable*>(Source);
+                new (Destination) Callable(std::move(*source));
+                source->~Callable();
+            },
+        .destroy =
+            [](void* Storage) noexcept {
+                static_cast<Callable*>(Storage)->~Callable();
+            },
+    };
+
+    template<typename Callable>
+    static constexpr operations HEAP_OPERATIONS = {
+        .invoke = [](void* Storage, Args&&... Arguments) -> Result {
+            return std::invoke(**static_cast<Callable**>(Storage),
+                               std::forward<Args>(Arguments)...);
+        },
+        .relocate =
+            [](void* Destination, void* Source) noexcept {
+                new (Destination) Callable*(*static_cast<Callable**>(Source));
+            },
+        .destroy =
+            [](void* Storage) noexcept {
+                delete *static_cast<Callable**>(Storage); // NOLINT
+            },
+    };
+
+    alignas(std::max_align_t) std::byte storage[CAPACITY]; // NOLINT
+    const operations* ops = nullptr;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    small_function() = default;
+    small_function(std::nullptr_t) // NOLINT
+    {
+    }
+
+    template<typename Function>
+        requires(
+            !std::is_same_v<std::decay_t<Function>, small_function> &&
+            std::is_invocable_r_v<Result, std::decay_t<Function>&, Args...>)
+    small_function(Function&& Callable) // NOLINT
+    {
+        using callable = std::decay_t<Function>;
+        if constexpr (std::is_pointer_v<callable> ||
+                      std::is_member_pointer_v<callable>) {
+            if (Callable == nullptr) {
+                return;
+            }
+        }
+        if constexpr (STORED_INLINE<callable>) {
+            new (this->storage) callable(std::forward<Function>(Callable));
+            this->ops = &INLINE_OPERATIONS<callable>;
+        } else {
+            new (this->storage)
+                callable*(new callable(std::forward<Function>(Callable)));
+            this->ops = &HEAP_OPERATIONS<callable>;
+        }
+    }
+
+    small_function(const small_function&) = delete;
+    small_function& operator=(const small_function&) = delete;
+
+    small_function(small_function&& Other) noexcept
+    {
+        this->TakeFrom(Other);
+    }
+
+    small_function& operator=(small_function&& Other) noexcept
+    {
+        if (this != &Other) {
+            this->Reset();
+            this->TakeFrom(Other);
+        }
+        return *this;
+    }
+
+    ~small_function()
+    {
+        this->Reset();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return this->ops != nullptr;
+    }
+
+    /// @warning Must not be empty.
+    Result operator()(Args... Arguments)
+    {
+        return this->ops->invoke(this->storage,
+                                 std::forward<Args>(Arguments)...);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief Destroys the stored callable, leaving this empty.
+    void Reset() noexcept
+    {
+        if (this->ops != nullptr) {
+            this->ops->destroy(this->storage);
+            this->ops = nullptr;
+        }
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    void TakeFrom(small_function& Other) noexcept
+    {
+        if (Other.ops != nullptr) {
+            Other.ops->relocate(this->storage, Other.storage);
+            this->ops = std::exchange(Other.ops, nullptr);
+        }
+    }
+};
+
+} // namespace gvw::internal
@@ -0,0 +1,328 @@
+#pragma once
+
+/**
+ * @file spsc_ring.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Lock-free single-producer/single-consumer ring buffer. Shared by GVW
+ * and its benchmarks, so it must not depend on anything but the standard
+ * library.
+ * @date 2023-10-07
+ */
+
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace gvw::internal {
+
+/// @brief Alignment that keeps data written by different threads on different
+/// cache lines.
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+/// @brief Values taken from a `spsc_ring` in the order they were pushed. The
+/// values are stored in up to two contiguous runs because the ring wraps.
+template<typename T>
+class spsc_ring_view
+{
+  public:
+    class iterator
+    {
+        const spsc_ring_view* view = nullptr;
+        size_t index = 0;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        iterator() = default;
+        iterator(const spsc_ring_view* View, size_t Index)
+            : view(View)
+            , index(Index)
+        {
+        }
+
+        reference operator*() const
+        {
+            return (*this->view)[this->index];
+        }
+        pointer operator->() const
+        {
+            return &(*this->view)[this->index];
+        }
+        iterator& operator++()
+        {
+            ++this->index;
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            ++this->index;
+            return previous;
+        }
+        bool operator==(const iterator& Iterator) const
+        {
+            return this->index == Iterator.index;
+        }
+    };
+
+    spsc_ring_view() = default;
+    spsc_ring_view(std::span<const T> First, std::span<const T> Second)
+        : first(First)
+        , second(Second)
+    {
+    }
+
+  private:
+    std::span<const T> first;
+    std::span<const T> second;
+
+  public:
+    [[nodiscard]] size_t Size() const
+    {
+        return this->first.size() + this->second.size();
+    }
+
+    [[nodiscard]] bool Empty() const
+    {
+        return this->Size() == 0;
+    }
+
+    [[nodiscard]] const T& operator[](size_t Index) const
+    {
+        return (Index < this->first.size())
+                   ? this->first[Index]
+                   : this->second[Index - this->first.size()];
+    }
+
+    /// @brief The values before the point where the ring wraps.
+    [[nodiscard]] std::span<const T> First() const
+    {
+        return this->first;
+    }
+
+    /// @brief The values after the point where the ring wraps.
+    [[nodiscard]] std::span<const T> Second() const
+    {
+        return this->second;
+    }
+
+    [[nodiscard]] iterator begin() const
+    {
+        return { this, 0 };
+    }
+
+    [[nodiscard]] iterator end() const
+    {
+        return { this, this->Size() };
+    }
+};
+
+/// @brief A fixed capacity queue written by one thread and read by another
+/// without locks. Memory is only allocated on construction. Values are stored
+/// in two rings that swap roles on every drain, so values held by the consumer
+/// never take room from new values. Memory for twice the capacity is allocated.
+/// @warning Only one thread may call the producer functions and only one
+/// thread may call the consumer functions at a time.
+template<typename T>
+class spsc_ring
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+  public:
+    /// @brief The largest capacity of a ring.
+    static constexpr size_t MAX_CAPACITY = size_t{ 1 } << 30;
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///                Constructors, Operators, and Destructor               ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    /// @brief The capacity is rounded up to a power of two and limited to
+    /// `MAX_CAPACITY`.
+    explicit spsc_ring(size_t Capacity)
+        : mask(std::bit_ceil(std::clamp<size_t>(Capacity, 1, MAX_CAPACITY)) -
+               1)
+        , slots(std::make_unique<T[]>(2 * (this->mask + 1))) // NOLINT
+    {
+    }
+
+    spsc_ring(const spsc_ring&) = delete;
+    spsc_ring(spsc_ring&&) noexcept = delete;
+    spsc_ring& operator=(const spsc_ring&) = delete;
+    spsc_ring& operator=(spsc_ring&&) noexcept = delete;
+    ~spsc_ring() = default;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                           Private Variables                          ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    // Layout of `state`: the number of values in the active ring, the index of
+    // the oldest of them, which ring is active, and whether the consumer is
+    // copying the active ring.
+    static constexpr unsigned START_SHIFT = 31;
+    static constexpr uint64_t COUNT_MASK = (uint64_t{ 1 } << START_SHIFT) - 1;
+    static constexpr uint64_t ACTIVE = uint64_t{ 1 } << 62;
+    static constexpr uint64_t COPYING = uint64_t{ 1 } << 63;
+
+    size_t mask;
+    std::unique_ptr<T[]> slots; // NOLINT
+
+    // The producer writes to the active ring and the consumer reads the other
+    // one, which holds the values handed out by the last call to `Drain`. Only
+    // the consumer swaps the rings. The producer only writes past the values in
+    // the active ring, so a write made with an outdated state is never read.
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> state = 0;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Public Member Functions                       ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] size_t Capacity() const
+    {
+        return this->mask + 1;
+    }
+
+    /// @brief Appends a value. Returns false if the ring is full.
+    /// @remark Producer only.
+    bool TryPush(const T& Value)
+    {
+        uint64_t current = this->state.load(std::memory_order_acquire);
+        while (true) {
+            size_t count = Count(current);
+            if (count > this->mask) {
+                return false;
+            }
+            this->Ring(current)[(Start(current) + count) & this->mask] = Value;
+            if (this->state.compare_exchange_weak(
+                    current, current + 1, std::memory_order_acq_rel)) {
+                return true;
+            }
+        }
+    }
+
+    /// @brief Removes the oldest value if the ring is full. Returns whether a
+    /// value was removed. Values held by the consumer are never removed, and
+    /// nothing is removed while the consumer copies the ring.
+    /// @remark Producer only.
+    bool TryDropOldest()
+    {
+        uint64_t current = this->state.load(std::memory_order_acquire);
+        while (true) {
+            if ((current & COPYING) != 0 || Count(current) <= this->mask) {
+                return false;
+            }
+            uint64_t start = (Start(current) + 1) & this->mask;
+            uint64_t next = (current & (ACTIVE | COPYING)) |
+                            (start << START_SHIFT) | (Count(current) - 1);
+            if (this->state.compare_exchange_weak(
+                    current, next, std::memory_order_acq_rel)) {
+                return true;
+            }
+        }
+    }
+
+    /// @brief Returns the number of values that have not been drained.
+    /// @remark Consumer only.
+    [[nodiscard]] size_t Size() const
+    {
+        return Count(this->state.load(std::memory_order_acquire));
+    }
+
+    /// @brief Releases the values returned by the previous call and returns
+    /// every value that has not been drained yet. Nothing is copied. The
+    /// returned view is valid until the next call to `Drain`, `PopAll`, or
+    /// `Clear`.
+    /// @remark Consumer only.
+    [[nodiscard]] spsc_ring_view<T> Drain()
+    {
+        return this->View(this->Swap());
+    }
+
+    /// @brief Appends every value that has not been drained to `Destination`
+    /// and removes every value from the ring.
+    /// @remark Consumer only.
+    void PopAll(std::vector<T>& Destination)
+    {
+        spsc_ring_view<T> view = this->Drain();
+        Destination.insert(
+            Destination.end(), view.First().begin(), view.First().end());
+        Destination.insert(
+            Destination.end(), view.Second().begin(), view.Second().end());
+    }
+
+    /// @brief Returns a copy of every value that has not been drained without
+    /// removing them.
+    /// @remark Consumer only.
+    [[nodiscard]] std::vector<T> Copy()
+    {
+        // Values cannot be dropped and then overwritten while they are copied.
+        spsc_ring_view<T> view = this->View(
+            this->state.fetch_or(COPYING, std::memory_order_acq_rel));
+        std::vector<T> values(view.begin(), view.end());
+        this->state.fetch_and(~COPYING, std::memory_order_release);
+        return values;
+    }
+
+    /// @brief Removes every value from the ring.
+    /// @remark Consumer only.
+    void Clear()
+    {
+        static_cast<void>(this->Swap());
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////
+    ///                        Private Member Functions                      ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] static size_t Count(uint64_t State)
+    {
+        return State & COUNT_MASK;
+    }
+
+    [[nodiscard]] static size_t Start(uint64_t State)
+    {
+        return (State >> START_SHIFT) & COUNT_MASK;
+    }
+
+    /// @brief Returns the first slot of the ring that is active in `State`.
+    [[nodiscard]] T* Ring(uint64_t State) const
+    {
+        size_t offset = ((State & ACTIVE) != 0) ? this->mask + 1 : 0;
+        return this->slots.get() + offset;
+    }
+
+    /// @brief Makes the other ring, and with it the values held by the
+    /// consumer, empty and active. Returns the previous state.
+    uint64_t Swap()
+    {
+        uint64_t current = this->state.load(std::memory_order_relaxed);
+        return this->state.exchange((current & ACTIVE) ^ ACTIVE,
+                                    std::memory_order_acq_rel);
+    }
+
+    /// @brief Returns the values of the ring that is active in `State`.
+    [[nodiscard]] spsc_ring_view<T> View(uint64_t State) const
+    {
+        const T* ring = this->Ring(State);
+        size_t start = Start(State);
+        size_t count = Count(State);
+        size_t firstCount = std::min(count, this->Capacity() - start);
+        return { { ring + start, firstCount }, { ring, count - firstCount } };
+    }
+};
+
+} // namespace gvw::internal
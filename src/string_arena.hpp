@@ -0,0 +1,135 @@
+#pragma once
+
+/**
+ * @file string_arena.hpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Bump allocated storage for copies of C strings. Must not depend on
+ * anything but the standard library.
+ * @date 2023-10-09
+ */
+
+// Standard includes
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace gvw::internal {
+
+/// @brief Copies groups of C strings into large chunks of memory that are
+/// released all at once. Copying a group allocates at most one chunk. After a
+/// reset, the arena fits everything copied before it in one chunk, so copying
+/// the same groups again allocates nothing.
+class string_arena
+{
+    /// @brief The smallest chunk allocated.
+    static constexpr size_t MIN_CHUNK_SIZE = 4096;
+
+    static constexpr size_t ALIGNMENT = alignof(std::string_view);
+
+    struct chunk
+    {
+        std::unique_ptr<std::byte[]> data; // NOLINT
+        size_t size;
+    };
+
+    std::vector<chunk> chunks;
+
+    /// @brief The number of bytes used in the last chunk.
+    size_t used = 0;
+
+    /// @brief The number of bytes used in every chunk but the last.
+    size_t usedBefore = 0;
+
+    /// @brief Returns `Size` bytes aligned for `std::string_view`.
+    std::byte* Allocate(size_t Size)
+    {
+        size_t offset = (this->used + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        if (this->chunks.empty() ||
+            offset + Size > this->chunks.back().size) {
+            size_t size = std::max(Size, MIN_CHUNK_SIZE);
+            this->chunks.push_back(
+                { std::make_unique<std::byte[]>(size), size }); // NOLINT
+            this->usedBefore += this->used;
+            offset = 0;
+        }
+        this->used = offset + Size;
+        return this->chunks.back().data.get() + offset;
+    }
+
+  public:
+    /// @brief A position in the arena returned by `GetMark`.
+    struct mark
+    {
+        size_t chunkCount;
+        size_t used;
+        size_t usedBefore;
+
+        bool operator==(const mark&) const = default;
+    };
+
+    /// @brief Copies every string and returns views of the copies. The copies
+    /// are null terminated and stay valid until the next call to `Reset`.
+    std::span<const std::string_view> Copy(
+        std::span<const char* const> Strings)
+    {
+        if (Strings.empty()) {
+            return {};
+        }
+
+        size_t size = Strings.size() * sizeof(std::string_view);
+        for (const char* string : Strings) {
+            size += std::strlen(string) + 1;
+        }
+
+        std::byte* memory = this->Allocate(size);
+        auto* views = reinterpret_cast<std::string_view*>(memory); // NOLINT
+        auto* characters = reinterpret_cast<char*>( // NOLINT
+            memory + Strings.size() * sizeof(std::string_view));
+        for (size_t i = 0; i < Strings.size(); ++i) {
+            size_t length = std::strlen(Strings[i]);
+            std::memcpy(characters, Strings[i], length + 1);
+            new (views + i) std::string_view(characters, length);
+            characters += length + 1;
+        }
+        return { views, Strings.size() };
+    }
+
+    /// @brief Returns the current position, which `Rewind` can return to.
+    [[nodiscard]] mark GetMark() const
+    {
+        return { this->chunks.size(), this->used, this->usedBefore };
+    }
+
+    /// @brief Releases every copy made since `Mark` was returned.
+    /// @warning `Reset` must not have been called since.
+    void Rewind(const mark& Mark)
+    {
+        this->chunks.resize(Mark.chunkCount);
+        this->used = Mark.used;
+        this->usedBefore = Mark.usedBefore;
+    }
+
+    /// @brief Invalidates every copy. If more than one chunk was needed since
+    /// the last reset, they are replaced by one chunk that fits all of them.
+    void Reset()
+    {
+        if (this->chunks.size() > 1) {
+            // Every group may need up to `ALIGNMENT - 1` bytes of padding once
+            // the groups are no longer at the start of a chunk.
+            size_t size = this->usedBefore + this->used +
+                          this->chunks.size() * (ALIGNMENT - 1);
+            this->chunks.clear();
+            this->chunks.push_back(
+                { std::make_unique<std::byte[]>(size), size }); // NOLINT
+        }
+        this->used = 0;
+        this->usedBefore = 0;
+    }
+};
+
+} // namespace gvw::internal
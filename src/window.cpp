@@ -7,6 +7,12 @@
 #include "window.hpp"
 #include "impl.hpp"
 
+// Generated includes
+#include "shaders/default.vert.hpp"
+#include "shaders/default.frag.hpp"
+#include "shaders/sprite.vert.hpp"
+#include "shaders/sprite.frag.hpp"
+
 namespace gvw {
 
 // NOLINTNEXTLINE
@@ -19,6 +25,21 @@ void window::DestroyGlfwWindow(GLFWwindow* Window_Handle) noexcept
 // NOLINTNEXTLINE
 window::window(const window_info& Window_Info, window* Parent_Window)
     : gvwInstance(internal::global::GVW_INSTANCE)
+    , keyEvents(Window_Info.eventBuffers.key.capacity)
+    , characterEvents(Window_Info.eventBuffers.character.capacity)
+    , cursorPositionEvents(Window_Info.eventBuffers.cursorPosition.capacity)
+    , cursorEnterEvents(Window_Info.eventBuffers.cursorEnter.capacity)
+    , mouseButtonEvents(Window_Info.eventBuffers.mouseButton.capacity)
+    , scrollEvents(Window_Info.eventBuffers.scroll.capacity, true)
+    , fileDropEvents(Window_Info.eventBuffers.fileDrop.capacity)
+    , sizeEvents(Window_Info.eventBuffers.size.capacity)
+    , framebufferSizeEvents(Window_Info.eventBuffers.framebufferSize.capacity)
+    , contentScaleEvents(Window_Info.eventBuffers.contentScale.capacity)
+    , positionEvents(Window_Info.eventBuffers.position.capacity)
+    , iconifyEvents(Window_Info.eventBuffers.iconify.capacity)
+    , maximizeEvents(Window_Info.eventBuffers.maximize.capacity)
+    , focusEvents(Window_Info.eventBuffers.focus.capacity)
+    , eventQueue(Window_Info.eventBuffers.queue.capacity)
 {
     /// @todo GVW could be destroyed and then reinitialized between the
     /// initialization of gvwInstance and this line below. Resolve this by
@@ -92,6 +113,9 @@ window::window(const window_info& Window_Info, window* Parent_Window)
         this->resetSize = this->GetSizeNoMutex();
     }
 
+    // Set window event buffer overflow policies.
+    this->SetEventOverflows(Window_Info.eventBuffers);
+
     // Set window event callbacks.
     this->SetEventCallbacks(Window_Info.eventCallbacks);
 
@@ -190,16 +214,16 @@ window::window(const window_info& Window_Info, window* Parent_Window)
     /// @todo Place shader utilities into separate functions or within the
     /// shader class.
     if (Window_Info.shaders.vertex != nullptr) {
-        if (this->shaders.vertex->handle.getOwner() !=
+        if (Window_Info.shaders.vertex->handle.getOwner() !=
             this->logicalDevice->GetHandle()) {
             ErrorCallback("Cannot use a vertex shader created with a different "
                           "logical device.");
         }
         this->shaders.vertex = Window_Info.shaders.vertex;
     } else {
-        // Attempt to load the default vertex shader.
+        // Load the default vertex shader embedded in the library.
         vertex_shader_info vertexShaderInfo = {
-            .general = { .code = "vert.spv",
+            .general = { .spirv = internal::DEFAULT_VERTEX_SHADER_SPIRV,
                          .stage = vk::ShaderStageFlagBits::eVertex },
             .bindingDescriptions = { { .binding = 0,
                                        .stride = sizeof(xy_rgb),
@@ -222,16 +246,16 @@ window::window(const window_info& Window_Info, window* Parent_Window)
     }
 
     if (Window_Info.shaders.fragment != nullptr) {
-        if (this->shaders.fragment->handle.getOwner() !=
+        if (Window_Info.shaders.fragment->handle.getOwner() !=
             this->logicalDevice->GetHandle()) {
             ErrorCallback("Cannot use a fragment shader created with a "
                           "different logical device.");
         }
         this->shaders.fragment = Window_Info.shaders.fragment;
     } else {
-        // Attempt to load the default fragment shader.
+        // Load the default fragment shader embedded in the library.
         fragment_shader_info fragmentShaderInfo = {
-            .general = { .code = "frag.spv",
+            .general = { .spirv = internal::DEFAULT_FRAGMENT_SHADER_SPIRV,
                          .stage = vk::ShaderStageFlagBits::eFragment }
         };
         this->shaders.fragment =
@@ -249,7 +273,9 @@ window::window(const window_info& Window_Info, window* Parent_Window)
         this->pipeline = Window_Info.pipeline;
     } else {
         this->CreatePipeline(
-            pipeline_dynamic_states_config::VIEWPORT_AND_SCISSOR);
+            pipeline_dynamic_states_config::VIEWPORT_AND_SCISSOR,
+            Window_Info.pushConstantRanges,
+            Window_Info.descriptorSetLayouts);
     }
 
     // Create the command pool.
@@ -318,8 +344,12 @@ window::window(const window_info& Window_Info, window* Parent_Window)
         .commandBufferCount = 1,
         .pCommandBuffers = &this->stagingCommandBuffer.get()
     };
-    this->graphicsQueue.submit({ stagingSubmitInfo });
-    this->graphicsQueue.waitIdle();
+    {
+        std::scoped_lock queueLock(
+            this->logicalDevice->GetQueueMutex(this->graphicsQueue));
+        this->graphicsQueue.submit({ stagingSubmitInfo });
+        this->graphicsQueue.waitIdle();
+    }
 
     // Create vertex staging buffer.
     this->staticVertexStagingBuffer = this->logicalDevice->CreateBuffer(
@@ -372,7 +402,7 @@ window::window(const window_info& Window_Info, window* Parent_Window)
 
 window::~window()
 {
-    this->logicalDevice->GetHandle().waitIdle();
+    this->logicalDevice->WaitIdle();
 }
 
 void window::SetUserPointer(void* Pointer)
@@ -392,16 +422,89 @@ void window::CreateSwapchain()
           .oldSwapchain = this->swapchain });
 }
 
-void window::CreatePipeline(const pipeline_dynamic_states& Dynamic_States)
+void window::CreatePipeline(
+    const pipeline_dynamic_states& Dynamic_States,
+    const pipeline_push_constant_ranges& Push_Constant_Ranges,
+    const pipeline_descriptor_set_layouts& Descriptor_Set_Layouts)
 {
     this->pipeline = this->logicalDevice->CreatePipeline(
         { .shaders = this->shaders,
           .dynamicStates = Dynamic_States,
-          .renderPass = this->renderPass->handle.get() });
+          .pushConstantRanges = Push_Constant_Ranges,
+          .descriptorSetLayouts = Descriptor_Set_Layouts,
+          .renderPass = this->renderPass });
 }
 
 void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
 {
+    this->DrawFrame(
+        Vertices,
+        { { .vertexCount = static_cast<uint32_t>(
+                this->staticVertexBuffer->size / sizeof(xy_rgb)) } });
+}
+
+bool window::ValidateDraws(
+    const std::vector<window_draw_info>& Draws,
+    const std::vector<window_dispatch_info>& Dispatches) const
+{
+    for (const auto& dispatch : Dispatches) {
+        if (dispatch.pipeline == nullptr) {
+            ErrorCallback("A dispatch requires a compute pipeline.");
+            return false;
+        }
+        if (!dispatch.pushConstants.empty() &&
+            !internal::PushConstantsFitLayout(
+                dispatch.pipeline->pushConstantRanges,
+                dispatch.pushConstantStages,
+                dispatch.pushConstantOffset,
+                dispatch.pushConstants.size())) {
+            ErrorCallback("The push constants of a dispatch must be within "
+                          "push constant ranges of its pipeline that include "
+                          "exactly the same shader stages.");
+            return false;
+        }
+    }
+
+    for (const auto& draw : Draws) {
+        if (draw.indirectBuffer != nullptr && draw.drawCount > 1 &&
+            this->logicalDevice->GetEnabledFeatures().multiDrawIndirect ==
+                VK_FALSE) {
+            ErrorCallback("Indirect draws with a draw count above one require "
+                          "the multiDrawIndirect device feature.");
+            return false;
+        }
+        if (draw.indirectBuffer != nullptr && draw.countBuffer != nullptr &&
+            this->logicalDevice->GetEnabledVulkan12Features()
+                    .drawIndirectCount == VK_FALSE) {
+            ErrorCallback("Indirect draws with a count buffer require the "
+                          "drawIndirectCount Vulkan 1.2 device feature.");
+            return false;
+        }
+
+        const pipeline_ptr& drawPipeline =
+            (draw.pipeline != nullptr) ? draw.pipeline : this->pipeline;
+        if (!draw.pushConstants.empty() &&
+            !internal::PushConstantsFitLayout(drawPipeline->pushConstantRanges,
+                                              draw.pushConstantStages,
+                                              draw.pushConstantOffset,
+                                              draw.pushConstants.size())) {
+            ErrorCallback("The push constants of a draw must be within push "
+                          "constant ranges of its pipeline that include "
+                          "exactly the same shader stages.");
+            return false;
+        }
+    }
+    return true;
+}
+
+void window::DrawFrame(const std::vector<xy_rgb>& Vertices,
+                       const std::vector<window_draw_info>& Draws,
+                       const std::vector<window_dispatch_info>& Dispatches)
+{
+    if (!this->ValidateDraws(Draws, Dispatches)) {
+        return;
+    }
+
     // Wait until the previous frame is done rendering.
     if (logicalDevice->GetHandle().waitForFences(
             this->inFlightFences.at(this->currentFrameIndex).get(),
@@ -419,7 +522,7 @@ void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
             nextImageAvailableSemaphores.at(currentFrameIndex).get());
 
     if (imageIndex.result == vk::Result::eErrorOutOfDateKHR) {
-        logicalDevice->GetHandle().waitIdle();
+        logicalDevice->WaitIdle();
         this->CreateSwapchain();
     } else if (imageIndex.result != vk::Result::eSuccess &&
                imageIndex.result != vk::Result::eSuboptimalKHR) {
@@ -447,8 +550,12 @@ void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
             .commandBufferCount = 1,
             .pCommandBuffers = &this->stagingCommandBuffer.get()
         };
-        this->graphicsQueue.submit({ stagingSubmitInfo });
-        this->graphicsQueue.waitIdle();
+        {
+            std::scoped_lock queueLock(
+                this->logicalDevice->GetQueueMutex(this->graphicsQueue));
+            this->graphicsQueue.submit({ stagingSubmitInfo });
+            this->graphicsQueue.waitIdle();
+        }
 
         // Use the command buffer to record drawing commands.
         vk::CommandBuffer commandBuffer =
@@ -460,6 +567,72 @@ void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
         };
         commandBuffer.begin(commandBufferBeginInfo);
 
+        // Record compute dispatches before the render pass.
+        for (size_t i = 0; i < Dispatches.size(); ++i) {
+            const window_dispatch_info& dispatch = Dispatches[i];
+            if (i > 0) {
+                // Make the writes of the previous dispatches visible to this
+                // one.
+                vk::MemoryBarrier computeToComputeBarrier = {
+                    .srcAccessMask = vk::AccessFlagBits::eShaderWrite,
+                    .dstAccessMask = vk::AccessFlagBits::eShaderRead |
+                                     vk::AccessFlagBits::eShaderWrite
+                };
+                commandBuffer.pipelineBarrier(
+                    vk::PipelineStageFlagBits::eComputeShader,
+                    vk::PipelineStageFlagBits::eComputeShader,
+                    {},
+                    computeToComputeBarrier,
+                    {},
+                    {});
+            }
+            commandBuffer.bindPipeline(vk::PipelineBindPoint::eCompute,
+                                       dispatch.pipeline->handle.get());
+            if (!dispatch.descriptorSets.empty()) {
+                commandBuffer.bindDescriptorSets(
+                    vk::PipelineBindPoint::eCompute,
+                    dispatch.pipeline->layout.get(),
+                    dispatch.firstSet,
+                    static_cast<uint32_t>(dispatch.descriptorSets.size()),
+                    dispatch.descriptorSets.data(),
+                    static_cast<uint32_t>(dispatch.dynamicOffsets.size()),
+                    dispatch.dynamicOffsets.data());
+            }
+            if (!dispatch.pushConstants.empty()) {
+                commandBuffer.pushConstants(
+                    dispatch.pipeline->layout.get(),
+                    dispatch.pushConstantStages,
+                    dispatch.pushConstantOffset,
+                    static_cast<uint32_t>(dispatch.pushConstants.size()),
+                    dispatch.pushConstants.data());
+            }
+            commandBuffer.dispatch(dispatch.groupCountX,
+                                   dispatch.groupCountY,
+                                   dispatch.groupCountZ);
+        }
+        if (!Dispatches.empty()) {
+            // Make compute writes visible to vertex input, indirect commands,
+            // and graphics shaders.
+            vk::MemoryBarrier computeToGraphicsBarrier = {
+                .srcAccessMask = vk::AccessFlagBits::eShaderWrite,
+                .dstAccessMask = vk::AccessFlagBits::eVertexAttributeRead |
+                                 vk::AccessFlagBits::eIndexRead |
+                                 vk::AccessFlagBits::eIndirectCommandRead |
+                                 vk::AccessFlagBits::eUniformRead |
+                                 vk::AccessFlagBits::eShaderRead
+            };
+            commandBuffer.pipelineBarrier(
+                vk::PipelineStageFlagBits::eComputeShader,
+                vk::PipelineStageFlagBits::eDrawIndirect |
+                    vk::PipelineStageFlagBits::eVertexInput |
+                    vk::PipelineStageFlagBits::eVertexShader |
+                    vk::PipelineStageFlagBits::eFragmentShader,
+                {},
+                computeToGraphicsBarrier,
+                {},
+                {});
+        }
+
         vk::ClearColorValue clearColor = { 0.0F, 0.0F, 0.0F, 1.0F };
         vk::ClearValue clearValue(clearColor);
 
@@ -481,10 +654,107 @@ void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
                                    this->pipeline->handle.get());
         commandBuffer.setViewport(0, this->swapchain->viewport);
         commandBuffer.setScissor(0, this->swapchain->scissor);
+        vk::Buffer boundVertexBuffer = this->staticVertexBuffer->handle.get();
+        vk::DeviceSize boundVertexBufferOffset = 0;
         commandBuffer.bindVertexBuffers(
-            0, { this->staticVertexBuffer->handle.get() }, { 0 });
-        commandBuffer.draw(
-            static_cast<uint32_t>(this->staticVertexBuffer->size), 1, 0, 0);
+            0, boundVertexBuffer, boundVertexBufferOffset);
+        vk::Pipeline boundPipeline = this->pipeline->handle.get();
+        for (const auto& draw : Draws) {
+            // Only rebind the pipeline when it changes.
+            const pipeline_ptr& drawPipeline =
+                (draw.pipeline != nullptr) ? draw.pipeline : this->pipeline;
+            if (drawPipeline->handle.get() != boundPipeline) {
+                boundPipeline = drawPipeline->handle.get();
+                commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics,
+                                           boundPipeline);
+            }
+
+            // Only rebind the vertex buffer when it changes.
+            vk::Buffer vertexBuffer = this->staticVertexBuffer->handle.get();
+            vk::DeviceSize vertexBufferOffset = 0;
+            if (draw.vertexBuffer != nullptr) {
+                vertexBuffer = draw.vertexBuffer->handle.get();
+                vertexBufferOffset = draw.vertexBufferOffset;
+            }
+            if (vertexBuffer != boundVertexBuffer ||
+                vertexBufferOffset != boundVertexBufferOffset) {
+                commandBuffer.bindVertexBuffers(
+                    0, vertexBuffer, vertexBufferOffset);
+                boundVertexBuffer = vertexBuffer;
+                boundVertexBufferOffset = vertexBufferOffset;
+            }
+            if (draw.indexBuffer != nullptr) {
+                commandBuffer.bindIndexBuffer(draw.indexBuffer->handle.get(),
+                                              draw.indexBufferOffset,
+                                              draw.indexType);
+            }
+            if (!draw.descriptorSets.empty()) {
+                commandBuffer.bindDescriptorSets(
+                    vk::PipelineBindPoint::eGraphics,
+                    drawPipeline->layout.get(),
+                    draw.firstSet,
+                    static_cast<uint32_t>(draw.descriptorSets.size()),
+                    draw.descriptorSets.data(),
+                    static_cast<uint32_t>(draw.dynamicOffsets.size()),
+                    draw.dynamicOffsets.data());
+            }
+            if (!draw.pushConstants.empty()) {
+                commandBuffer.pushConstants(
+                    drawPipeline->layout.get(),
+                    draw.pushConstantStages,
+                    draw.pushConstantOffset,
+                    static_cast<uint32_t>(draw.pushConstants.size()),
+                    draw.pushConstants.data());
+            }
+            bool indexed = draw.indexBuffer != nullptr;
+            if (draw.indirectBuffer != nullptr) {
+                uint32_t stride = draw.indirectStride;
+                if (stride == 0) {
+                    stride = indexed ? sizeof(vk::DrawIndexedIndirectCommand)
+                                     : sizeof(vk::DrawIndirectCommand);
+                }
+                if (draw.countBuffer != nullptr && indexed) {
+                    commandBuffer.drawIndexedIndirectCount(
+                        draw.indirectBuffer->handle.get(),
+                        draw.indirectBufferOffset,
+                        draw.countBuffer->handle.get(),
+                        draw.countBufferOffset,
+                        draw.drawCount,
+                        stride);
+                } else if (draw.countBuffer != nullptr) {
+                    commandBuffer.drawIndirectCount(
+                        draw.indirectBuffer->handle.get(),
+                        draw.indirectBufferOffset,
+                        draw.countBuffer->handle.get(),
+                        draw.countBufferOffset,
+                        draw.drawCount,
+                        stride);
+                } else if (indexed) {
+                    commandBuffer.drawIndexedIndirect(
+                        draw.indirectBuffer->handle.get(),
+                        draw.indirectBufferOffset,
+                        draw.drawCount,
+                        stride);
+                } else {
+                    commandBuffer.drawIndirect(
+                        draw.indirectBuffer->handle.get(),
+                        draw.indirectBufferOffset,
+                        draw.drawCount,
+                        stride);
+                }
+            } else if (indexed) {
+                commandBuffer.drawIndexed(draw.vertexCount,
+                                          draw.instanceCount,
+                                          draw.firstIndex,
+                                          draw.vertexOffset,
+                                          draw.firstInstance);
+            } else {
+                commandBuffer.draw(draw.vertexCount,
+                                   draw.instanceCount,
+                                   draw.firstVertex,
+                                   draw.firstInstance);
+            }
+        }
         commandBuffer.endRenderPass();
 
         commandBuffer.end();
@@ -502,8 +772,12 @@ void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
         };
 
         // Submit the command buffer to the graphics queue.
-        graphicsQueue.submit(submitInfo,
-                             inFlightFences.at(currentFrameIndex).get());
+        {
+            std::scoped_lock queueLock(
+                this->logicalDevice->GetQueueMutex(this->graphicsQueue));
+            graphicsQueue.submit(submitInfo,
+                                 inFlightFences.at(currentFrameIndex).get());
+        }
 
         // Configure presentation.
         vk::PresentInfoKHR presentInfo = {
@@ -518,10 +792,15 @@ void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
 
         // Presents the rendered image to the swapchain which is then
         // displayed on the window surface.
-        vk::Result presentResult = presentQueue.presentKHR(&presentInfo);
+        vk::Result presentResult = vk::Result::eSuccess;
+        {
+            std::scoped_lock queueLock(
+                this->logicalDevice->GetQueueMutex(this->presentQueue));
+            presentResult = presentQueue.presentKHR(&presentInfo);
+        }
         if (presentResult == vk::Result::eErrorOutOfDateKHR ||
             presentResult == vk::Result::eSuboptimalKHR) {
-            logicalDevice->GetHandle().waitIdle();
+            logicalDevice->WaitIdle();
             this->CreateSwapchain();
         } else if (presentResult != vk::Result::eSuccess) {
             ErrorCallback("Presentation failed.");
@@ -531,6 +810,125 @@ void window::DrawFrame(const std::vector<xy_rgb>& Vertices)
     }
 }
 
+sprite_batch_ptr window::CreateSpriteBatch(
+    const sprite_batch_info& Sprite_Batch_Info)
+{
+    if (Sprite_Batch_Info.atlas == nullptr ||
+        Sprite_Batch_Info.maxSprites == 0) {
+        ErrorCallback("A sprite batch requires an atlas and room for at least "
+                      "one sprite.");
+        return nullptr;
+    }
+
+    // Each sprite is one instance. The quad is generated in the vertex shader.
+    vertex_shader_info vertexShaderInfo = {
+        .general = { .name = "sprite.vert",
+                     .spirv = internal::SPRITE_VERTEX_SHADER_SPIRV,
+                     .stage = vk::ShaderStageFlagBits::eVertex },
+        .bindingDescriptions = { { .binding = 0,
+                                   .stride = sizeof(internal::sprite_instance),
+                                   .inputRate =
+                                       vk::VertexInputRate::eInstance } },
+        .attributeDescriptions = {
+            { { .location = 0,
+                .binding = 0,
+                .format = vk::Format::eR32G32Sfloat,
+                .offset = offsetof(internal::sprite_instance, position) },
+              { .location = 1,
+                .binding = 0,
+                .format = vk::Format::eR32G32Sfloat,
+                .offset = offsetof(internal::sprite_instance, size) },
+              { .location = 2,
+                .binding = 0,
+                .format = vk::Format::eR32G32Sfloat,
+                .offset = offsetof(internal::sprite_instance, uvMin) },
+              { .location = 3,
+                .binding = 0,
+                .format = vk::Format::eR32G32Sfloat,
+                .offset = offsetof(internal::sprite_instance, uvMax) },
+              { .location = 4,
+                .binding = 0,
+                .format = vk::Format::eR32G32B32A32Sfloat,
+                .offset = offsetof(internal::sprite_instance, color) } } }
+    };
+    pipeline_shaders spriteShaders = {
+        .vertex = this->logicalDevice->LoadVertexShaderFromSpirVFile(
+            vertexShaderInfo),
+        .fragment = this->logicalDevice->LoadFragmentShaderFromSpirVFile(
+            { .general = { .name = "sprite.frag",
+                           .spirv = internal::SPRITE_FRAGMENT_SHADER_SPIRV,
+                           .stage = vk::ShaderStageFlagBits::eFragment } })
+    };
+    if (spriteShaders.vertex == nullptr || spriteShaders.fragment == nullptr) {
+        return nullptr;
+    }
+
+    descriptor_set_layout_bindings bindings = {
+        { .binding = 0,
+          .descriptorType = vk::DescriptorType::eCombinedImageSampler,
+          .descriptorCount = 1,
+          .stageFlags = vk::ShaderStageFlagBits::eFragment }
+    };
+    descriptor_set_layout_ptr descriptorSetLayout =
+        this->logicalDevice->CreateDescriptorSetLayout(
+            { .bindings = bindings });
+    pipeline_descriptor_set_layouts descriptorSetLayouts = {
+        descriptorSetLayout
+    };
+    pipeline_ptr spritePipeline = this->logicalDevice->CreatePipeline(
+        { .shaders = spriteShaders,
+          .descriptorSetLayouts = descriptorSetLayouts,
+          .renderPass = this->renderPass,
+          .colorBlend = pipeline_color_blend_config::ALPHA });
+    if (spritePipeline == nullptr) {
+        return nullptr;
+    }
+
+    // Every page of the atlas is bound through its own descriptor set.
+    std::vector<vk::DescriptorSet> pageDescriptorSets;
+    pageDescriptorSets.reserve(Sprite_Batch_Info.atlas->pages.size());
+    for (const texture_ptr& page : Sprite_Batch_Info.atlas->pages) {
+        vk::DescriptorSet descriptorSet =
+            this->logicalDevice->AllocateDescriptorSet(descriptorSetLayout);
+        vk::DescriptorImageInfo descriptorImageInfo = {
+            .sampler = page->sampler.get(),
+            .imageView = page->view.get(),
+            .imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal
+        };
+        vk::WriteDescriptorSet writeDescriptorSet = {
+            .dstSet = descriptorSet,
+            .dstBinding = 0,
+            .dstArrayElement = 0,
+            .descriptorCount = 1,
+            .descriptorType = vk::DescriptorType::eCombinedImageSampler,
+            .pImageInfo = &descriptorImageInfo
+        };
+        this->logicalDevice->GetHandle().updateDescriptorSets(
+            writeDescriptorSet, {});
+        pageDescriptorSets.push_back(descriptorSet);
+    }
+
+    // Instances are written while earlier frames may still be read, so the
+    // ring has one more region than there are frames in flight.
+    buffer_ring_ptr instanceRing = this->logicalDevice->CreateBufferRing(
+        { .sizeInBytesPerFrame = static_cast<vk::DeviceSize>(
+                                     Sprite_Batch_Info.maxSprites) *
+                                 sizeof(internal::sprite_instance),
+          .frameCount = MAX_FRAMES_IN_FLIGHT + 1,
+          .usage = vk::BufferUsageFlagBits::eVertexBuffer });
+    if (instanceRing == nullptr) {
+        return nullptr;
+    }
+
+    return std::make_shared<internal::sprite_batch_public_constructor>(
+        Sprite_Batch_Info.atlas,
+        std::move(spritePipeline),
+        std::move(descriptorSetLayout),
+        std::move(pageDescriptorSets),
+        std::move(instanceRing),
+        Sprite_Batch_Info.maxSprites);
+}
+
 int window::GetWindowAttribute(int Attribute)
 {
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
@@ -555,10 +953,47 @@ int window::GetInputMode(int Mode)
     return glfwGetInputMode(this->windowHandle, Mode);
 }
 
+void window::SetEventOverflows(const window_event_buffers_info& Event_Buffers)
+{
+    this->keyEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.key.overflow));
+    this->characterEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.character.overflow));
+    this->cursorPositionEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.cursorPosition.overflow));
+    this->cursorEnterEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.cursorEnter.overflow));
+    this->mouseButtonEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.mouseButton.overflow));
+    this->scrollEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.scroll.overflow));
+    this->fileDropEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.fileDrop.overflow));
+    this->sizeEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.size.overflow));
+    this->framebufferSizeEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.framebufferSize.overflow));
+    this->contentScaleEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.contentScale.overflow));
+    this->positionEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.position.overflow));
+    this->iconifyEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.iconify.overflow));
+    this->maximizeEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.maximize.overflow));
+    this->focusEvents.SetOverflow(
+        internal::event_overflow(Event_Buffers.focus.overflow));
+    this->eventQueue.SetOverflow(
+        internal::event_overflow(Event_Buffers.queue.overflow));
+}
+
 void window::SetEventCallbacksNoMutex(
-    const window_event_callbacks& Window_Event_Callbacks) const
+    const window_event_callbacks& Window_Event_Callbacks)
 {
-    glfwSetKeyCallback(this->windowHandle, Window_Event_Callbacks.keyCallback);
+    // The key and mouse button callbacks always go through GVW so that the
+    // input state tables stay up to date.
+    this->eventCallbacks = Window_Event_Callbacks;
+    glfwSetKeyCallback(this->windowHandle, internal::KeyCallback);
     glfwSetCharCallback(this->windowHandle,
                         Window_Event_Callbacks.characterCallback);
     glfwSetCursorPosCallback(this->windowHandle,
@@ -566,7 +1001,7 @@ void window::SetEventCallbacksNoMutex(
     glfwSetCursorEnterCallback(this->windowHandle,
                                Window_Event_Callbacks.cursorEnterCallback);
     glfwSetMouseButtonCallback(this->windowHandle,
-                               Window_Event_Callbacks.mouseButtonCallback);
+                               internal::MouseButtonCallback);
     glfwSetScrollCallback(this->windowHandle,
                           Window_Event_Callbacks.scrollCallback);
     glfwSetDropCallback(this->windowHandle,
@@ -635,9 +1070,111 @@ void window::ShowNoMutex() const
 void window::SetEventCallbacks(const window_event_callbacks& Event_Callbacks)
 {
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    this->cursorPositionEvents.SetCoalescing(internal::event_coalescing(
+        Event_Callbacks.cursorPositionCoalescing));
+    this->scrollEvents.SetCoalescing(
+        internal::event_coalescing(Event_Callbacks.scrollCoalescing));
+    this->sizeEvents.SetCoalescing(
+        internal::event_coalescing(Event_Callbacks.sizeCoalescing));
+    this->framebufferSizeEvents.SetCoalescing(internal::event_coalescing(
+        Event_Callbacks.framebufferSizeCoalescing));
     this->SetEventCallbacksNoMutex(Event_Callbacks);
 }
 
+void window::SetEventHandlers(window_event_handlers Event_Handlers)
+{
+    std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    this->eventHandlers = std::move(Event_Handlers);
+}
+
+void window::InjectEvent(const window_event& Event)
+{
+    std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    auto call = [this](auto Callback, auto... Arguments) {
+        if (Callback != nullptr) {
+            Callback(this->windowHandle, Arguments...);
+        }
+    };
+
+    const window_event_callbacks& callbacks = this->eventCallbacks;
+    switch (Event.type) {
+        case window_event_type::eKey:
+            internal::KeyCallback(this->windowHandle,
+                                  int(Event.key.key),
+                                  Event.key.scancode,
+                                  int(Event.key.action),
+                                  Event.key.mods);
+            break;
+        case window_event_type::eCharacter:
+            call(callbacks.characterCallback, Event.character);
+            break;
+        case window_event_type::eCursorPosition:
+            call(callbacks.cursorPositionCallback,
+                 Event.cursorPosition.x,
+                 Event.cursorPosition.y);
+            break;
+        case window_event_type::eCursorEnter:
+            call(callbacks.cursorEnterCallback, Event.cursorEnter);
+            break;
+        case window_event_type::eMouseButton:
+            internal::MouseButtonCallback(this->windowHandle,
+                                          Event.mouseButton.button,
+                                          Event.mouseButton.action,
+                                          Event.mouseButton.mods);
+            break;
+        case window_event_type::eScroll:
+            call(callbacks.scrollCallback, Event.scroll.x, Event.scroll.y);
+            break;
+        case window_event_type::eFileDrop: {
+            // GLFW passes null terminated paths.
+            std::vector<std::string> paths(Event.fileDrop.paths.begin(),
+                                           Event.fileDrop.paths.end());
+            std::vector<const char*> pathPointers;
+            pathPointers.reserve(paths.size());
+            for (const std::string& path : paths) {
+                pathPointers.push_back(path.c_str());
+            }
+            call(callbacks.fileDropCallback,
+                 int(pathPointers.size()),
+                 pathPointers.data());
+            break;
+        }
+        case window_event_type::eClose:
+            call(callbacks.closeCallback);
+            break;
+        case window_event_type::eSize:
+            call(callbacks.sizeCallback, Event.size.width, Event.size.height);
+            break;
+        case window_event_type::eFramebufferSize:
+            call(callbacks.framebufferSizeCallback,
+                 Event.framebufferSize.width,
+                 Event.framebufferSize.height);
+            break;
+        case window_event_type::eContentScale:
+            call(callbacks.contentScaleCallback,
+                 Event.contentScale.x,
+                 Event.contentScale.y);
+            break;
+        case window_event_type::ePosition:
+            call(callbacks.positionCallback,
+                 Event.position.x,
+                 Event.position.y);
+            break;
+        case window_event_type::eIconify:
+            call(callbacks.iconifyCallback, Event.iconify);
+            break;
+        case window_event_type::eMaximize:
+            call(callbacks.maximizeCallback, Event.maximize);
+            break;
+        case window_event_type::eFocus:
+            call(callbacks.focusCallback, Event.focus);
+            break;
+        case window_event_type::eRefresh:
+            call(callbacks.refreshCallback);
+            break;
+    }
+}
+
 window_ptr window::CreateChildWindow(const window_info& Window_Info)
 {
     return std::make_shared<internal::window_public_constructor>(Window_Info,
@@ -651,200 +1188,178 @@ GLFWwindow* window::GetHandle() const noexcept
 
 std::vector<window_key_event> window::GetKeyEvents() noexcept
 {
-    std::scoped_lock lock(this->keyEventsMutex);
-    return this->keyEvents;
+    return this->keyEvents.Copy();
 }
 
 std::vector<window_character_event> window::GetCharacterEvents() noexcept
 {
-    std::scoped_lock lock(this->characterEventsMutex);
-    return this->characterEvents;
+    return this->characterEvents.Copy();
 }
 
 std::vector<window_cursor_position_event>
 window::GetCursorPositionEvents() noexcept
 {
-    std::scoped_lock lock(this->cursorPositionEventsMutex);
-    return this->cursorPositionEvents;
+    return this->cursorPositionEvents.Copy();
 }
 
 std::vector<window_cursor_enter_event> window::GetCursorEnterEvents() noexcept
 {
-    std::scoped_lock lock(this->cursorEnterEventsMutex);
-    return this->cursorEnterEvents;
+    return this->cursorEnterEvents.Copy();
 }
 
 std::vector<window_mouse_button_event> window::GetMouseButtonEvents() noexcept
 {
-    std::scoped_lock lock(this->mouseButtonEventsMutex);
-    return this->mouseButtonEvents;
+    return this->mouseButtonEvents.Copy();
 }
 
 std::vector<window_scroll_event> window::GetScrollEvents() noexcept
 {
-    std::scoped_lock lock(this->scrollEventsMutex);
-    return this->scrollEvents;
+    return this->scrollEvents.Copy();
 }
 
 std::vector<window_file_drop_event> window::GetFileDropEvents() noexcept
 {
-    std::scoped_lock lock(this->fileDropEventsMutex);
-    return this->fileDropEvents;
+    std::scoped_lock lock(this->fileDropPaths.mutex);
+    return this->fileDropEvents.Copy();
 }
 
 [[nodiscard]] size_t window::GetCloseEvents() noexcept
 {
-    std::scoped_lock lock(this->closeEventsMutex);
-    return this->closeEvents;
+    return this->closeEvents.load();
 }
 
 [[nodiscard]] std::vector<window_size_event> window::GetSizeEvents() noexcept
 {
-    std::scoped_lock lock(this->sizeEventsMutex);
-    return this->sizeEvents;
+    return this->sizeEvents.Copy();
 }
 
 [[nodiscard]] std::vector<window_framebuffer_size_event>
 window::GetFramebufferSizeEvents() noexcept
 {
-    std::scoped_lock lock(this->framebufferSizeEventsMutex);
-    return this->framebufferSizeEvents;
+    return this->framebufferSizeEvents.Copy();
 }
 
 [[nodiscard]] std::vector<window_content_scale_event>
 window::GetContentScaleEvents() noexcept
 {
-    std::scoped_lock lock(this->contentScaleEventsMutex);
-    return this->contentScaleEvents;
+    return this->contentScaleEvents.Copy();
 }
 
 [[nodiscard]] std::vector<window_position_event>
 window::GetPositionEvents() noexcept
 {
-    std::scoped_lock lock(this->positionEventsMutex);
-    return this->positionEvents;
+    return this->positionEvents.Copy();
 }
 
 [[nodiscard]] std::vector<window_iconify_event>
 window::GetIconifyEvents() noexcept
 {
-    std::scoped_lock lock(this->iconifyEventsMutex);
-    return this->iconifyEvents;
+    return this->iconifyEvents.Copy();
 }
 
 [[nodiscard]] std::vector<window_maximize_event>
 window::GetMaximizeEvents() noexcept
 {
-    std::scoped_lock lock(this->maximizeEventsMutex);
-    return this->maximizeEvents;
+    return this->maximizeEvents.Copy();
 }
 
 [[nodiscard]] std::vector<window_focus_event> window::GetFocusEvents() noexcept
 {
-    std::scoped_lock lock(this->focusEventsMutex);
-    return this->focusEvents;
+    return this->focusEvents.Copy();
 }
 
 [[nodiscard]] size_t window::GetRefreshEvents() noexcept
 {
-    std::scoped_lock lock(this->refreshEventsMutex);
-    return this->refreshEvents;
+    return this->refreshEvents.load();
 }
 
 void window::ClearKeyEvents() noexcept
 {
-    std::scoped_lock lock(this->keyEventsMutex);
-    this->keyEvents.clear();
+    this->keyEvents.Clear();
 }
 
 void window::ClearCharacterEvents() noexcept
 {
-    std::scoped_lock lock(this->characterEventsMutex);
-    this->characterEvents.clear();
+    this->characterEvents.Clear();
 }
 
 void window::ClearCursorPositionEvents() noexcept
 {
-    std::scoped_lock lock(this->cursorPositionEventsMutex);
-    this->cursorPositionEvents.clear();
+    this->cursorPositionEvents.Clear();
 }
 
 void window::ClearCursorEnterEvents() noexcept
 {
-    std::scoped_lock lock(this->cursorEnterEventsMutex);
-    this->cursorEnterEvents.clear();
+    this->cursorEnterEvents.Clear();
 }
 
 void window::ClearMouseButtonEvents() noexcept
 {
-    std::scoped_lock lock(this->mouseButtonEventsMutex);
-    this->mouseButtonEvents.clear();
+    this->mouseButtonEvents.Clear();
 }
 
 void window::ClearScrollEvents() noexcept
 {
-    std::scoped_lock lock(this->scrollEventsMutex);
-    this->scrollEvents.clear();
+    this->scrollEvents.Clear();
 }
 
 void window::ClearFileDropEvents() noexcept
 {
-    std::scoped_lock lock(this->fileDropEventsMutex);
-    this->fileDropEvents.clear();
+    std::scoped_lock lock(this->fileDropPaths.mutex);
+    this->fileDropPaths.Clear();
+    this->fileDropEvents.Clear();
 }
 
 void window::ClearCloseEvents() noexcept
 {
-    std::scoped_lock lock(this->closeEventsMutex);
-    this->closeEvents = 0;
+    this->closeEvents.store(0);
 }
 
 void window::ClearSizeEvents() noexcept
 {
-    std::scoped_lock lock(this->sizeEventsMutex);
-    this->sizeEvents.clear();
+    this->sizeEvents.Clear();
 }
 
 void window::ClearFramebufferSizeEvents() noexcept
 {
-    std::scoped_lock lock(this->framebufferSizeEventsMutex);
-    this->framebufferSizeEvents.clear();
+    this->framebufferSizeEvents.Clear();
 }
 
 void window::ClearContentScaleEvents() noexcept
 {
-    std::scoped_lock lock(this->contentScaleEventsMutex);
-    this->contentScaleEvents.clear();
+    this->contentScaleEvents.Clear();
 }
 
 void window::ClearPositionEvents() noexcept
 {
-    std::scoped_lock lock(this->positionEventsMutex);
-    this->positionEvents.clear();
+    this->positionEvents.Clear();
 }
 
 void window::ClearIconifyEvents() noexcept
 {
-    std::scoped_lock lock(this->iconifyEventsMutex);
-    this->iconifyEvents.clear();
+    this->iconifyEvents.Clear();
 }
 
 void window::ClearMaximizeEvents() noexcept
 {
-    std::scoped_lock lock(this->maximizeEventsMutex);
-    this->maximizeEvents.clear();
+    this->maximizeEvents.Clear();
 }
 
 void window::ClearFocusEvents() noexcept
 {
-    std::scoped_lock lock(this->focusEventsMutex);
-    this->focusEvents.clear();
+    this->focusEvents.Clear();
 }
 
 void window::ClearRefreshEvents() noexcept
 {
-    std::scoped_lock lock(this->refreshEventsMutex);
-    this->refreshEvents = 0;
+    this->refreshEvents.store(0);
+}
+
+void window::ClearEventQueue() noexcept
+{
+    std::scoped_lock lock(this->eventQueuePaths.mutex);
+    this->eventQueuePaths.Clear();
+    this->eventQueue.Clear();
 }
 
 void window::ClearEvents() noexcept
@@ -865,29 +1380,181 @@ void window::ClearEvents() noexcept
     this->ClearMaximizeEvents();
     this->ClearFocusEvents();
     this->ClearRefreshEvents();
+    this->ClearEventQueue();
 }
 
-window_key_action window::GetKeyState(window_key Key)
+window_event_drop_counts window::GetDroppedEvents() const noexcept
 {
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    return window_key_action(glfwGetKey(this->windowHandle, int(Key)));
+    window_event_drop_counts counts = {};
+    counts.key = this->keyEvents.GetDropped();
+    counts.character = this->characterEvents.GetDropped();
+    counts.cursorPosition = this->cursorPositionEvents.GetDropped();
+    counts.cursorEnter = this->cursorEnterEvents.GetDropped();
+    counts.mouseButton = this->mouseButtonEvents.GetDropped();
+    counts.scroll = this->scrollEvents.GetDropped();
+    counts.fileDrop = this->fileDropEvents.GetDropped();
+    counts.size = this->sizeEvents.GetDropped();
+    counts.framebufferSize = this->framebufferSizeEvents.GetDropped();
+    counts.contentScale = this->contentScaleEvents.GetDropped();
+    counts.position = this->positionEvents.GetDropped();
+    counts.iconify = this->iconifyEvents.GetDropped();
+    counts.maximize = this->maximizeEvents.GetDropped();
+    counts.focus = this->focusEvents.GetDropped();
+    counts.queue = this->eventQueue.GetDropped();
+    return counts;
 }
 
-bool window::IsKeyPressed(window_key Key)
+window_events<window_key_event> window::DrainKeyEvents() noexcept
+{
+    return this->keyEvents.Drain();
+}
+
+window_events<window_character_event> window::DrainCharacterEvents() noexcept
+{
+    return this->characterEvents.Drain();
+}
+
+window_events<window_cursor_position_event>
+window::DrainCursorPositionEvents() noexcept
+{
+    return this->cursorPositionEvents.Drain();
+}
+
+window_events<window_cursor_enter_event>
+window::DrainCursorEnterEvents() noexcept
+{
+    return this->cursorEnterEvents.Drain();
+}
+
+window_events<window_mouse_button_event>
+window::DrainMouseButtonEvents() noexcept
+{
+    return this->mouseButtonEvents.Drain();
+}
+
+window_events<window_scroll_event> window::DrainScrollEvents() noexcept
+{
+    return this->scrollEvents.Drain();
+}
+
+window_events<window_file_drop_event> window::DrainFileDropEvents() noexcept
+{
+    std::scoped_lock lock(this->fileDropPaths.mutex);
+    this->fileDropPaths.Drain();
+    return this->fileDropEvents.Drain();
+}
+
+size_t window::DrainCloseEvents() noexcept
+{
+    return this->closeEvents.exchange(0);
+}
+
+window_events<window_size_event> window::DrainSizeEvents() noexcept
+{
+    return this->sizeEvents.Drain();
+}
+
+window_events<window_framebuffer_size_event>
+window::DrainFramebufferSizeEvents() noexcept
+{
+    return this->framebufferSizeEvents.Drain();
+}
+
+window_events<window_content_scale_event>
+window::DrainContentScaleEvents() noexcept
+{
+    return this->contentScaleEvents.Drain();
+}
+
+window_events<window_position_event> window::DrainPositionEvents() noexcept
+{
+    return this->positionEvents.Drain();
+}
+
+window_events<window_iconify_event> window::DrainIconifyEvents() noexcept
+{
+    return this->iconifyEvents.Drain();
+}
+
+window_events<window_maximize_event> window::DrainMaximizeEvents() noexcept
+{
+    return this->maximizeEvents.Drain();
+}
+
+window_events<window_focus_event> window::DrainFocusEvents() noexcept
+{
+    return this->focusEvents.Drain();
+}
+
+size_t window::DrainRefreshEvents() noexcept
+{
+    return this->refreshEvents.exchange(0);
+}
+
+window_events<window_event> window::DrainEvents() noexcept
+{
+    std::scoped_lock lock(this->eventQueuePaths.mutex);
+    this->eventQueuePaths.Drain();
+    return this->eventQueue.Drain();
+}
+
+window_key_action window::GetKeyState(window_key Key) const noexcept
+{
+    return this->keyStates.IsDown(size_t(Key)) ? window_key_action::ePress
+                                               : window_key_action::eRelease;
+}
+
+bool window::IsKeyPressed(window_key Key) const noexcept
 {
     return (this->GetKeyState(Key) == window_key_action::ePress);
 }
 
-bool window::IsKeyReleased(window_key Key)
+bool window::IsKeyReleased(window_key Key) const noexcept
 {
     return (this->GetKeyState(Key) == window_key_action::eRelease);
 }
 
-bool window::IsKeyRepeating(window_key Key)
+bool window::IsKeyRepeating(window_key Key) const noexcept
 {
     return (this->GetKeyState(Key) == window_key_action::eRepeat);
 }
 
+bool window::WasKeyPressedThisFrame(window_key Key) const noexcept
+{
+    return this->keyStates.WasPressed(size_t(Key));
+}
+
+bool window::WasKeyReleasedThisFrame(window_key Key) const noexcept
+{
+    return this->keyStates.WasReleased(size_t(Key));
+}
+
+bool window::IsMouseButtonPressed(int Button) const noexcept
+{
+    return this->mouseButtonStates.IsDown(size_t(Button));
+}
+
+bool window::IsMouseButtonReleased(int Button) const noexcept
+{
+    return !this->IsMouseButtonPressed(Button);
+}
+
+bool window::WasMouseButtonPressedThisFrame(int Button) const noexcept
+{
+    return this->mouseButtonStates.WasPressed(size_t(Button));
+}
+
+bool window::WasMouseButtonReleasedThisFrame(int Button) const noexcept
+{
+    return this->mouseButtonStates.WasReleased(size_t(Button));
+}
+
+void window::NextInputFrame() noexcept
+{
+    this->keyStates.NextFrame();
+    this->mouseButtonStates.NextFrame();
+}
+
 coordinate<double> window::GetCursorPosition()
 {
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
@@ -1128,15 +1795,14 @@ bool window::IsTransparent()
 void window::EnterFullScreen(const monitor_ptr& Full_Screen_Monitor,
                              const GLFWvidmode* Video_Mode)
 {
-    /// @todo Avoid deadlock here.
-    this->resetMutex.lock();
-    this->resetPosition = this->GetPosition();
-    this->resetSize = this->GetSize();
-    this->resetMutex.unlock();
+    // Handlers may call this while events are polled, so both locks are taken
+    // together to avoid deadlock.
+    std::scoped_lock lock(internal::global::GLFW_MUTEX, this->resetMutex);
+    this->resetPosition = this->GetPositionNoMutex();
+    this->resetSize = this->GetSizeNoMutex();
     const GLFWvidmode* videoMode = Video_Mode == nullptr
                                        ? Full_Screen_Monitor->GetVideoMode()
                                        : Video_Mode;
-    std::scoped_lock lock(internal::global::GLFW_MUTEX);
     glfwSetWindowMonitor(this->windowHandle,
                          Full_Screen_Monitor->GetHandle(),
                          GLFW_FALSE,
@@ -1170,14 +1836,18 @@ void window::SetCursorShape(const cursor_ptr& Cursor) // NOLINT
         ErrorCallback("Failed to set cursor. Cursor pointer is NULL.");
         return;
     }
-    this->cursor = Cursor;
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    if (this->cursor == Cursor) {
+        return;
+    }
+    this->cursor = Cursor;
     glfwSetCursor(this->windowHandle, this->cursor->handle);
 }
 
 void window::ResetCursorShape()
 {
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    this->cursor = nullptr;
     glfwSetCursor(this->windowHandle, nullptr);
 }
 
@@ -1229,6 +1899,7 @@ void window::EnableStickyKeys()
         static_cast<int>(internal::window_input_mode::eStickyKeys),
         static_cast<int>(
             internal::window_input_mode_sticky_mouse_buttons::eTrue));
+    this->keyStates.SetSticky(true);
 }
 
 void window::DisableStickyKeys()
@@ -1237,6 +1908,7 @@ void window::DisableStickyKeys()
         static_cast<int>(internal::window_input_mode::eStickyKeys),
         static_cast<int>(
             internal::window_input_mode_sticky_mouse_buttons::eFalse));
+    this->keyStates.SetSticky(false);
 }
 
 bool window::IsStickyKeysEnabled()
@@ -1253,6 +1925,7 @@ void window::EnableStickyMouseButtons()
         static_cast<int>(internal::window_input_mode::eStickyMouseButtons),
         static_cast<int>(
             internal::window_input_mode_sticky_mouse_buttons::eTrue));
+    this->mouseButtonStates.SetSticky(true);
 }
 
 void window::DisableStickyMouseButtons()
@@ -1261,6 +1934,7 @@ void window::DisableStickyMouseButtons()
         static_cast<int>(internal::window_input_mode::eStickyMouseButtons),
         static_cast<int>(
             internal::window_input_mode_sticky_mouse_buttons::eFalse));
+    this->mouseButtonStates.SetSticky(false);
 }
 
 bool window::IsStickyMouseButtonsEnabled()
@@ -1277,16 +1951,24 @@ void window::SetIcon(const image_ptr& Icon)
         ErrorCallback("Failed to set icon. Icon pointer is NULL.");
         return;
     }
-    GLFWimage iconImage = { .width = Icon->size.width,
-                            .height = Icon->size.height,
-                            .pixels = Icon->data };
+    if (Icon->data == nullptr) {
+        ErrorCallback("Failed to set icon. The icon image has no data.");
+        return;
+    }
+    std::shared_ptr<const internal::window_icon> windowIcon =
+        this->gvwInstance->GetWindowIcon(Icon);
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
-    glfwSetWindowIcon(this->windowHandle, 1, &iconImage);
+    if (this->icon == windowIcon) {
+        return;
+    }
+    this->icon = std::move(windowIcon);
+    glfwSetWindowIcon(this->windowHandle, 1, &this->icon->glfwImage);
 }
 
 void window::ResetIcon()
 {
     std::scoped_lock lock(internal::global::GLFW_MUTEX);
+    this->icon = nullptr;
     glfwSetWindowIcon(this->windowHandle, 0, nullptr);
 }
 
@@ -54,6 +54,9 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief The window cursor.
     cursor_ptr cursor;
 
+    /// @brief The window icon. Setting the same icon again is skipped.
+    std::shared_ptr<const internal::window_icon> icon;
+
     /// @brief Window surface.
     vk::UniqueSurfaceKHR surface;
 
@@ -112,69 +115,84 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @todo Figure out how to make these private.
   public:
     // NOLINTBEGIN
+    // Event callbacks run on the thread that polls for events and are the only
+    // producers. Reading and clearing the buffers of one window must be done
+    // from one thread at a time.
+
     /// @brief Key events.
-    std::vector<window_key_event> keyEvents;
-    std::mutex keyEventsMutex;
+    internal::event_stream<window_key_event> keyEvents;
 
     /// @brief Character events.
-    std::vector<window_character_event> characterEvents;
-    std::mutex characterEventsMutex;
+    internal::event_stream<window_character_event> characterEvents;
 
     /// @brief Cursor position events.
-    std::vector<window_cursor_position_event> cursorPositionEvents;
-    std::mutex cursorPositionEventsMutex;
+    internal::event_stream<window_cursor_position_event> cursorPositionEvents;
 
     /// @brief Cursor enter events.
-    std::vector<window_cursor_enter_event> cursorEnterEvents;
-    std::mutex cursorEnterEventsMutex;
+    internal::event_stream<window_cursor_enter_event> cursorEnterEvents;
 
     /// @brief Mouse button events.
-    std::vector<window_mouse_button_event> mouseButtonEvents;
-    std::mutex mouseButtonEventsMutex;
+    internal::event_stream<window_mouse_button_event> mouseButtonEvents;
 
     /// @brief Scroll events.
-    std::vector<window_scroll_event> scrollEvents;
-    std::mutex scrollEventsMutex;
+    internal::event_stream<window_scroll_event> scrollEvents;
 
     /// @brief File drop events.
-    std::vector<window_file_drop_event> fileDropEvents;
-    std::mutex fileDropEventsMutex;
+    internal::event_stream<window_file_drop_event> fileDropEvents;
+
+    /// @brief Copies of the paths of file drop events.
+    internal::file_drop_paths fileDropPaths;
 
     /// @brief The number of close events.
-    size_t closeEvents = 0;
-    std::mutex closeEventsMutex;
+    std::atomic<size_t> closeEvents = 0;
 
     /// @brief Size events.
-    std::vector<window_size_event> sizeEvents;
-    std::mutex sizeEventsMutex;
+    internal::event_stream<window_size_event> sizeEvents;
 
     /// @brief Framebuffer size events.
-    std::vector<window_framebuffer_size_event> framebufferSizeEvents;
-    std::mutex framebufferSizeEventsMutex;
+    internal::event_stream<window_framebuffer_size_event> framebufferSizeEvents;
 
     /// @brief Content scale events.
-    std::vector<window_content_scale_event> contentScaleEvents;
-    std::mutex contentScaleEventsMutex;
+    internal::event_stream<window_content_scale_event> contentScaleEvents;
 
     /// @brief Position events.
-    std::vector<window_position_event> positionEvents;
-    std::mutex positionEventsMutex;
+    internal::event_stream<window_position_event> positionEvents;
 
     /// @brief Iconify events.
-    std::vector<window_iconify_event> iconifyEvents;
-    std::mutex iconifyEventsMutex;
+    internal::event_stream<window_iconify_event> iconifyEvents;
 
     /// @brief Maximize events.
-    std::vector<window_maximize_event> maximizeEvents;
-    std::mutex maximizeEventsMutex;
+    internal::event_stream<window_maximize_event> maximizeEvents;
 
     /// @brief Focus events.
-    std::vector<window_focus_event> focusEvents;
-    std::mutex focusEventsMutex;
+    internal::event_stream<window_focus_event> focusEvents;
 
     /// @brief The number of refresh events.
-    size_t refreshEvents = 0;
-    std::mutex refreshEventsMutex;
+    std::atomic<size_t> refreshEvents = 0;
+
+    /// @brief Handlers called by the `CALL_EVENT_HANDLER` event callbacks.
+    /// Only accessed while `GLFW_MUTEX` is locked.
+    window_event_handlers eventHandlers;
+
+    /// @brief Copies of the paths passed to the file drop event handler.
+    internal::string_arena handlerPaths;
+
+    /// @brief Which keys and mouse buttons are down.
+    internal::input_state<internal::KEY_COUNT> keyStates;
+    internal::input_state<internal::MOUSE_BUTTON_COUNT> mouseButtonStates;
+
+    /// @brief The selected event callbacks. The key and mouse button callbacks
+    /// are called after the input state tables are updated. Only accessed while
+    /// `GLFW_MUTEX` is locked.
+    window_event_callbacks eventCallbacks;
+
+    /// @brief Every event in the order it was received. Only populated by the
+    /// `APPEND_TO_EVENT_QUEUE` event callbacks.
+    internal::event_stream<window_event> eventQueue;
+
+    /// @brief Copies of the paths of file drop events in the unified event
+    /// queue.
+    internal::file_drop_paths eventQueuePaths;
 
     // NOLINTEND
   private:
@@ -189,7 +207,16 @@ class window : public internal::uncopyable_unmovable // NOLINT
     void CreateSwapchain();
 
     /// @brief Creates the graphics pipeline.
-    void CreatePipeline(const pipeline_dynamic_states& Dynamic_States);
+    void CreatePipeline(
+        const pipeline_dynamic_states& Dynamic_States,
+        const pipeline_push_constant_ranges& Push_Constant_Ranges,
+        const pipeline_descriptor_set_layouts& Descriptor_Set_Layouts);
+
+    /// @brief Returns false after reporting the first draw or dispatch that
+    /// cannot be recorded.
+    [[nodiscard]] bool ValidateDraws(
+        const std::vector<window_draw_info>& Draws,
+        const std::vector<window_dispatch_info>& Dispatches) const;
 
   public:
     /// @brief Draws a frame.
@@ -198,6 +225,18 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @todo Make this function private or remove it entirely.
     void DrawFrame(const std::vector<xy_rgb>& Vertices);
 
+    /// @brief Draws a frame with one draw command per element of `Draws`. Each
+    /// draw may set push constants before it is recorded. Compute dispatches
+    /// are recorded before the render pass. The writes of each dispatch are
+    /// visible to the following dispatches and to the draws.
+    void DrawFrame(const std::vector<xy_rgb>& Vertices,
+                   const std::vector<window_draw_info>& Draws,
+                   const std::vector<window_dispatch_info>& Dispatches = {});
+
+    /// @brief Creates a sprite batch whose draws can be passed to `DrawFrame`.
+    [[nodiscard]] sprite_batch_ptr CreateSpriteBatch(
+        const sprite_batch_info& Sprite_Batch_Info);
+
   private:
     /// @brief Returns an attribute of the window.
     [[nodiscard]] int GetWindowAttribute(int Attribute);
@@ -211,11 +250,16 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Returns the value of an input mode of the window.
     [[nodiscard]] int GetInputMode(int Mode);
 
-    /// @brief Sets GLFW event callbacks. Passing no arguments sets all default
-    /// event callbacks, which populate the event buffers.
+    /// @brief Sets what each event buffer does when it is full.
+    /// @warning This function is NOT thread safe.
+    void SetEventOverflows(const window_event_buffers_info& Event_Buffers);
+
+    /// @brief Sets GLFW event callbacks and the coalescing of the event
+    /// buffers. Passing no arguments sets all default event callbacks, which
+    /// populate the event buffers.
     /// @warning This function is NOT thread safe.
     void SetEventCallbacksNoMutex(
-        const window_event_callbacks& Event_Callbacks) const;
+        const window_event_callbacks& Event_Callbacks);
 
     /// @brief Returns the size of the content area of the window in screen
     /// coordinates.
@@ -251,10 +295,22 @@ class window : public internal::uncopyable_unmovable // NOLINT
     ///                        Public Member Functions                       ///
     ////////////////////////////////////////////////////////////////////////////
 
-    /// @brief Sets GLFW event callbacks. Passing no arguments sets all default
-    /// event callbacks, which populate the event buffers.
+    /// @brief Sets GLFW event callbacks and the coalescing of the event
+    /// buffers. Passing no arguments sets all default event callbacks, which
+    /// populate the event buffers.
     void SetEventCallbacks(const window_event_callbacks& Event_Callbacks);
 
+    /// @brief Sets the handlers called by the `CALL_EVENT_HANDLER` event
+    /// callbacks. Events are handled as soon as they are received without
+    /// being buffered.
+    void SetEventHandlers(window_event_handlers Event_Handlers);
+
+    /// @brief Passes an event to the selected event callbacks as if GLFW had
+    /// just received it. Used to replay recorded input without a user.
+    /// @remark Event handlers run on the calling thread, with the same rules
+    /// as handlers run while events are polled.
+    void InjectEvent(const window_event& Event);
+
     /// @brief Creates a child window.
     [[nodiscard]] window_ptr CreateChildWindow(
         const window_info& Window_Info = window_info_config::DEFAULT);
@@ -262,6 +318,11 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Returns the handle to the underlying GLFW window object.
     [[nodiscard]] GLFWwindow* GetHandle() const noexcept;
 
+    // Buffered events are read from single-consumer rings, so only one thread
+    // at a time may get, clear, or drain the events of a window. The close and
+    // refresh counters and the drop counts are atomic and may be read from any
+    // thread.
+
     /// @brief Returns the key event buffer.
     [[nodiscard]] std::vector<window_key_event> GetKeyEvents() noexcept;
 
@@ -284,7 +345,8 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// @brief Returns the scroll event buffer.
     [[nodiscard]] std::vector<window_scroll_event> GetScrollEvents() noexcept;
 
-    /// @brief Returns the file drop event buffer.
+    /// @brief Returns the file drop event buffer. The paths stay valid until
+    /// the buffer is drained or cleared.
     [[nodiscard]] std::vector<window_file_drop_event>
     GetFileDropEvents() noexcept;
 
@@ -368,17 +430,127 @@ class window : public internal::uncopyable_unmovable // NOLINT
     /// zero.
     void ClearRefreshEvents() noexcept;
 
-    /// @brief Clears all event buffers.
-    void ClearEvents() noexcept;
+    /// @brief Clears the unified event queue.
+    void ClearEventQueue() noexcept;
 
-    /// @brief Returns the state of a key.
-    [[nodiscard]] window_key_action GetKeyState(window_key Key);
-
-    /// @todo Write functions for getting the mouse button states.
+    /// @brief Clears all event buffers and the unified event queue.
+    void ClearEvents() noexcept;
 
-    [[nodiscard]] bool IsKeyPressed(window_key Key);
-    [[nodiscard]] bool IsKeyReleased(window_key Key);
-    [[nodiscard]] bool IsKeyRepeating(window_key Key);
+    /// @brief Returns the key events received since the last drain without
+    /// copying them.
+    [[nodiscard]] window_events<window_key_event> DrainKeyEvents() noexcept;
+
+    /// @brief Returns the character events received since the last drain
+    /// without copying them.
+    [[nodiscard]] window_events<window_character_event>
+    DrainCharacterEvents() noexcept;
+
+    /// @brief Returns the cursor position events received since the last drain
+    /// without copying them.
+    [[nodiscard]] window_events<window_cursor_position_event>
+    DrainCursorPositionEvents() noexcept;
+
+    /// @brief Returns the cursor enter events received since the last drain
+    /// without copying them.
+    [[nodiscard]] window_events<window_cursor_enter_event>
+    DrainCursorEnterEvents() noexcept;
+
+    /// @brief Returns the mouse button events received since the last drain
+    /// without copying them.
+    [[nodiscard]] window_events<window_mouse_button_event>
+    DrainMouseButtonEvents() noexcept;
+
+    /// @brief Returns the scroll events received since the last drain without
+    /// copying them.
+    [[nodiscard]] window_events<window_scroll_event>
+    DrainScrollEvents() noexcept;
+
+    /// @brief Returns the file drop events received since the last drain
+    /// without copying them.
+    [[nodiscard]] window_events<window_file_drop_event>
+    DrainFileDropEvents() noexcept;
+
+    /// @brief Returns the number of close events received by the window since
+    /// the last drain or clear and resets it to zero.
+    [[nodiscard]] size_t DrainCloseEvents() noexcept;
+
+    /// @brief Returns the size events received since the last drain without
+    /// copying them.
+    [[nodiscard]] window_events<window_size_event> DrainSizeEvents() noexcept;
+
+    /// @brief Returns the framebuffer size events received since the last drain
+    /// without copying them.
+    [[nodiscard]] window_events<window_framebuffer_size_event>
+    DrainFramebufferSizeEvents() noexcept;
+
+    /// @brief Returns the content scale events received since the last drain
+    /// without copying them.
+    [[nodiscard]] window_events<window_content_scale_event>
+    DrainContentScaleEvents() noexcept;
+
+    /// @brief Returns the position events received since the last drain without
+    /// copying them.
+    [[nodiscard]] window_events<window_position_event>
+    DrainPositionEvents() noexcept;
+
+    /// @brief Returns the iconify events received since the last drain without
+    /// copying them.
+    [[nodiscard]] window_events<window_iconify_event>
+    DrainIconifyEvents() noexcept;
+
+    /// @brief Returns the maximize events received since the last drain without
+    /// copying them.
+    [[nodiscard]] window_events<window_maximize_event>
+    DrainMaximizeEvents() noexcept;
+
+    /// @brief Returns the focus events received since the last drain without
+    /// copying them.
+    [[nodiscard]] window_events<window_focus_event> DrainFocusEvents() noexcept;
+
+    /// @brief Returns the number of refresh events received by the window since
+    /// the last drain or clear and resets it to zero.
+    [[nodiscard]] size_t DrainRefreshEvents() noexcept;
+
+    /// @brief Returns the events in the unified event queue received since the
+    /// last drain, in the order they were received, without copying them.
+    [[nodiscard]] window_events<window_event> DrainEvents() noexcept;
+
+    /// @brief Returns the number of events each event buffer has dropped since
+    /// the window was created.
+    [[nodiscard]] window_event_drop_counts GetDroppedEvents() const noexcept;
+
+    // Key and mouse button states are read from tables kept up to date by
+    // event polling, so they may be queried from any thread without locking.
+    // A "frame" lasts from one call to `NextInputFrame` to the next.
+
+    /// @brief Returns the state of a key. Never returns
+    /// `window_key_action::eRepeat`.
+    [[nodiscard]] window_key_action GetKeyState(window_key Key) const noexcept;
+
+    [[nodiscard]] bool IsKeyPressed(window_key Key) const noexcept;
+    [[nodiscard]] bool IsKeyReleased(window_key Key) const noexcept;
+    [[nodiscard]] bool IsKeyRepeating(window_key Key) const noexcept;
+
+    /// @brief Returns whether a key went down during the current frame, even if
+    /// it has been released again since.
+    [[nodiscard]] bool WasKeyPressedThisFrame(window_key Key) const noexcept;
+
+    /// @brief Returns whether a key went up during the current frame, even if
+    /// it has been pressed again since.
+    [[nodiscard]] bool WasKeyReleasedThisFrame(window_key Key) const noexcept;
+
+    /// @param Button A GLFW mouse button, such as `GLFW_MOUSE_BUTTON_LEFT`.
+    [[nodiscard]] bool IsMouseButtonPressed(int Button) const noexcept;
+    [[nodiscard]] bool IsMouseButtonReleased(int Button) const noexcept;
+    [[nodiscard]] bool WasMouseButtonPressedThisFrame(
+        int Button) const noexcept;
+    [[nodiscard]] bool WasMouseButtonReleasedThisFrame(
+        int Button) const noexcept;
+
+    /// @brief Starts a new frame by forgetting which keys and mouse buttons
+    /// were pressed or released during the current one.
+    /// @warning Only one thread may call this at a time.
+    void NextInputFrame() noexcept;
 
     [[nodiscard]] coordinate<double> GetCursorPosition();
     void SetCursorPosition(coordinate<double> Position);
@@ -528,10 +700,14 @@ class window : public internal::uncopyable_unmovable // NOLINT
     void ResetCursorVisibility();
     [[nodiscard]] bool IsCursorVisible();
 
+    /// @brief Makes a key released since its state was last queried report as
+    /// pressed once, so presses shorter than a frame are not missed. Applies to
+    /// `GetKeyState` and the `IsKey*` functions.
     void EnableStickyKeys();
     void DisableStickyKeys();
     [[nodiscard]] bool IsStickyKeysEnabled();
 
+    /// @brief Like `EnableStickyKeys`, but for the `IsMouseButton*` functions.
     void EnableStickyMouseButtons();
     void DisableStickyMouseButtons();
     [[nodiscard]] bool IsStickyMouseButtonsEnabled();
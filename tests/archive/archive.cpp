@@ -0,0 +1,107 @@
+// Standard includes
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+// Local includes
+#include "../../gvw/gvw.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+namespace {
+
+/// @brief Packed by the build from the files in `GVW_TEST_ARCHIVE_DATA`.
+const char* const ARCHIVE_PATH = GVW_TEST_ARCHIVE; // NOLINT
+
+const std::string TRUNCATED_ARCHIVE_PATH = // NOLINT
+    (std::filesystem::temp_directory_path() / "gvw_archive_test.gvwa")
+        .string();
+
+} // namespace
+
+std::string ReadWholeFile(const std::filesystem::path& Path)
+{
+    std::ifstream file(Path, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file),
+             std::istreambuf_iterator<char>() };
+}
+
+void TestFind()
+{
+    gvw::archive_ptr archive = gvw::OpenArchive(ARCHIVE_PATH);
+    test::Assert(archive != nullptr, "Failed to open the archive");
+
+    for (std::string_view name :
+         { "empty.txt", "hello.txt", "nested/lines.txt" }) {
+        std::string expected = ReadWholeFile(
+            std::filesystem::path(GVW_TEST_ARCHIVE_DATA) / name);
+        auto blob = archive->Find(name);
+        test::Assert(blob.has_value(),
+                     "\"" + std::string(name) + "\" is missing");
+        test::Assert(blob->size() == expected.size() &&
+                         (expected.empty() ||
+                          std::memcmp(blob->data(),
+                                      expected.data(),
+                                      expected.size()) == 0),
+                     "\"" + std::string(name) + "\" has the wrong contents");
+        // Archives are mapped at page boundaries, so the address of a blob is
+        // aligned if its offset is.
+        test::Assert(reinterpret_cast<uintptr_t>(blob->data()) % // NOLINT
+                             gvw::internal::ARCHIVE_BLOB_ALIGNMENT ==
+                         0,
+                     "\"" + std::string(name) + "\" is not aligned");
+    }
+}
+
+void TestMissingNames()
+{
+    gvw::archive_ptr archive = gvw::OpenArchive(ARCHIVE_PATH);
+    test::Assert(archive != nullptr, "Failed to open the archive");
+    for (std::string_view name :
+         { "", "hello", "hello.txt.", "lines.txt", "nested", "HELLO.TXT" }) {
+        test::Assert(!archive->Find(name).has_value(),
+                     "Found \"" + std::string(name) + "\"");
+    }
+}
+
+void TestRejectInvalidArchives()
+{
+    std::string bytes = ReadWholeFile(ARCHIVE_PATH);
+    auto opens = [](const std::string& Bytes) {
+        {
+            std::ofstream file(TRUNCATED_ARCHIVE_PATH,
+                               std::ios::binary | std::ios::trunc);
+            file.write(Bytes.data(),
+                       static_cast<std::streamsize>(Bytes.size()));
+        }
+        return gvw::OpenArchive(TRUNCATED_ARCHIVE_PATH.c_str()) != nullptr;
+    };
+
+    test::Assert(opens(bytes), "A copy of the archive is valid");
+    // The last blob is not empty, so removing a byte cuts it short.
+    test::Assert(!opens(bytes.substr(0, bytes.size() - 1)), "Truncated blob");
+    test::Assert(
+        !opens(bytes.substr(0, sizeof(gvw::internal::archive_header))),
+        "Truncated table of contents");
+    test::Assert(!opens(bytes.substr(0, 4)), "Truncated header");
+
+    std::string corrupted = bytes;
+    corrupted[0] = 'X';
+    test::Assert(!opens(corrupted), "Bad magic");
+    test::Assert(gvw::OpenArchive("missing.gvwa") == nullptr, "Missing file");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Find", TestFind);
+    passed &= test::ForThrow("Missing names", TestMissingNames);
+    passed &= test::ForThrow("Reject invalid archives",
+                             TestRejectInvalidArchives);
+    std::filesystem::remove(TRUNCATED_ARCHIVE_PATH);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,188 @@
+// Standard includes
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Local includes
+#include "../../gvw/gvw.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+namespace {
+
+const std::string RECORDING_PATH = // NOLINT
+    (std::filesystem::temp_directory_path() / "gvw_event_recording_test.gvwe")
+        .string();
+
+} // namespace
+
+/// @brief Appends the lowest `Size` bytes of `Value` in little endian order.
+void AppendLittleEndian(std::string& Bytes, uint64_t Value, size_t Size)
+{
+    for (size_t i = 0; i < Size; ++i) {
+        Bytes.push_back(static_cast<char>((Value >> (i * 8)) & 0xFF));
+    }
+}
+
+void AppendRecord(std::string& Bytes,
+                  uint64_t Time,
+                  gvw::window_event_type Type,
+                  const std::string& Data)
+{
+    AppendLittleEndian(Bytes, Time, 8);
+    AppendLittleEndian(Bytes, static_cast<uint64_t>(Type), 4);
+    AppendLittleEndian(Bytes, Data.size(), 4);
+    Bytes += Data;
+}
+
+std::string ReadRecording()
+{
+    std::ifstream file(RECORDING_PATH, std::ios::binary);
+    return { std::istreambuf_iterator<char>(file),
+             std::istreambuf_iterator<char>() };
+}
+
+void WriteRecording(const std::string& Bytes)
+{
+    std::ofstream file(RECORDING_PATH, std::ios::binary | std::ios::trunc);
+    file.write(Bytes.data(), static_cast<std::streamsize>(Bytes.size()));
+}
+
+bool OpensRecording(const std::string& Bytes)
+{
+    WriteRecording(Bytes);
+    return gvw::OpenEventRecording(RECORDING_PATH.c_str()) != nullptr;
+}
+
+/// @brief Records a key press, a cursor movement, a file drop, and a close
+/// event, and returns the bytes the recording must hold.
+std::string RecordEvents()
+{
+    std::vector<std::string_view> paths = { "a.png", "dir/b" };
+    auto start = std::chrono::steady_clock::now();
+
+    gvw::window_event key = {};
+    key.type = gvw::window_event_type::eKey;
+    key.time = start;
+    key.key = { gvw::window_key(GLFW_KEY_A),
+                38,
+                gvw::window_key_action::ePress,
+                GLFW_MOD_SHIFT };
+
+    gvw::window_event cursor = {};
+    cursor.type = gvw::window_event_type::eCursorPosition;
+    cursor.time = start + std::chrono::nanoseconds(1000);
+    cursor.cursorPosition = { 1.5, -2.25 };
+
+    gvw::window_event drop = {};
+    drop.type = gvw::window_event_type::eFileDrop;
+    drop.time = start + std::chrono::nanoseconds(2000);
+    drop.fileDrop = { paths };
+
+    gvw::window_event close = {};
+    close.type = gvw::window_event_type::eClose;
+    close.time = start + std::chrono::nanoseconds(3000);
+
+    {
+        gvw::event_recorder_ptr recorder =
+            gvw::CreateEventRecorder(RECORDING_PATH.c_str());
+        test::Assert(recorder != nullptr, "Failed to create a recording");
+        for (const gvw::window_event& event : { key, cursor, drop, close }) {
+            recorder->Record(event);
+        }
+    }
+
+    std::string expected = "GVWE";
+    AppendLittleEndian(expected, gvw::internal::EVENT_RECORDING_VERSION, 4);
+
+    std::string data;
+    AppendLittleEndian(data, GLFW_KEY_A, 4);
+    AppendLittleEndian(data, 38, 4);
+    AppendLittleEndian(data, GLFW_PRESS, 4);
+    AppendLittleEndian(data, GLFW_MOD_SHIFT, 4);
+    AppendRecord(expected, 0, key.type, data);
+
+    data.clear();
+    AppendLittleEndian(data, std::bit_cast<uint64_t>(1.5), 8);
+    AppendLittleEndian(data, std::bit_cast<uint64_t>(-2.25), 8);
+    AppendRecord(expected, 1000, cursor.type, data);
+
+    data.clear();
+    AppendLittleEndian(data, paths.size(), 4);
+    for (std::string_view path : paths) {
+        AppendLittleEndian(data, path.size(), 4);
+        data += path;
+    }
+    AppendRecord(expected, 2000, drop.type, data);
+
+    AppendRecord(expected, 3000, close.type, {});
+    return expected;
+}
+
+void TestWrite()
+{
+    std::string expected = RecordEvents();
+    test::Assert(ReadRecording() == expected,
+                 "The recording does not hold the expected bytes");
+}
+
+void TestRead()
+{
+    std::string bytes = RecordEvents();
+    gvw::event_replayer_ptr replayer =
+        gvw::OpenEventRecording(RECORDING_PATH.c_str());
+    test::Assert(replayer != nullptr, "Failed to open a valid recording");
+    test::Assert(replayer->Size() == 4, "Wrong number of events");
+    test::Assert(!replayer->Finished(), "Finished before replaying");
+
+    // Only the header.
+    test::Assert(OpensRecording(bytes.substr(0, 8)), "Empty recording");
+}
+
+void TestRejectCorruption()
+{
+    const std::string bytes = RecordEvents();
+
+    // Offsets into the recording written by `RecordEvents`.
+    const size_t keyActionOffset = 8 + 16 + 8;
+    const size_t dropOffset = 8 + (16 + 16) + (16 + 16);
+    const size_t dropDataSize = 4 + (4 + 5) + (4 + 5);
+
+    std::string corrupted = bytes;
+    corrupted[0] = 'X';
+    test::Assert(!OpensRecording(corrupted), "Bad magic");
+
+    corrupted = bytes;
+    corrupted[4] = 2;
+    test::Assert(!OpensRecording(corrupted), "Unknown version");
+
+    corrupted = bytes;
+    corrupted[keyActionOffset] = 7;
+    test::Assert(!OpensRecording(corrupted), "Unknown key action");
+
+    corrupted = bytes;
+    corrupted.insert(dropOffset + 16 + dropDataSize, 1, '\0');
+    ++corrupted[dropOffset + 12];
+    test::Assert(!OpensRecording(corrupted), "Trailing bytes in an event");
+
+    test::Assert(!OpensRecording(bytes + '\0'), "Trailing byte");
+    test::Assert(!OpensRecording(bytes.substr(0, bytes.size() - 1)),
+                 "Truncated record");
+    test::Assert(!OpensRecording(bytes.substr(0, 6)), "Truncated header");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Write", TestWrite);
+    passed &= test::ForThrow("Read", TestRead);
+    passed &= test::ForThrow("Reject corruption", TestRejectCorruption);
+    std::filesystem::remove(RECORDING_PATH);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
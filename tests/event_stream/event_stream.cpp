@@ -0,0 +1,171 @@
+// Standard includes
+#include <cstdlib>
+#include <vector>
+
+// Local includes
+#include "../../src/event_stream.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+using gvw::internal::event_coalescing;
+using gvw::internal::event_overflow;
+using gvw::internal::event_stream;
+
+/// @brief A value without addition or subtraction.
+struct label
+{
+    int id;
+};
+
+template<typename T>
+std::vector<T> Drain(event_stream<T>& Stream)
+{
+    auto view = Stream.Drain();
+    return { view.begin(), view.end() };
+}
+
+void TestKeepAll()
+{
+    event_stream<int> stream(8);
+    for (int i = 0; i < 3; ++i) {
+        test::Assert(stream.Push(i), "Push");
+    }
+    test::Assert(stream.Copy() == std::vector<int>{ 0, 1, 2 }, "Copy");
+    test::Assert(Drain(stream) == std::vector<int>{ 0, 1, 2 }, "Drain");
+    test::Assert(Drain(stream).empty(), "Second drain");
+}
+
+void TestKeepLatest()
+{
+    event_stream<int> stream(2);
+    stream.SetCoalescing(event_coalescing::KEEP_LATEST);
+    for (int i = 0; i < 100; ++i) {
+        test::Assert(stream.Push(i), "Coalesced events are never dropped");
+    }
+    test::Assert(stream.Copy() == std::vector<int>{ 99 }, "Copy");
+    test::Assert(Drain(stream) == std::vector<int>{ 99 }, "Drain");
+    test::Assert(Drain(stream).empty(), "Second drain");
+    test::Assert(stream.GetDropped() == 0, "Nothing is dropped");
+}
+
+void TestAccumulateRelative()
+{
+    event_stream<int> stream(2, true);
+    stream.SetCoalescing(event_coalescing::ACCUMULATE);
+    for (int i = 1; i <= 4; ++i) {
+        static_cast<void>(stream.Push(i));
+    }
+    test::Assert(Drain(stream) == std::vector<int>{ 10 }, "Sum of changes");
+    static_cast<void>(stream.Push(-3));
+    test::Assert(Drain(stream) == std::vector<int>{ -3 },
+                 "Sum since the last drain");
+    static_cast<void>(stream.Push(5));
+    stream.Clear();
+    test::Assert(Drain(stream).empty(), "Clear discards the sum");
+}
+
+void TestAccumulateAbsolute()
+{
+    event_stream<int> stream(2);
+    stream.SetCoalescing(event_coalescing::ACCUMULATE);
+    static_cast<void>(stream.Push(100));
+    test::Assert(Drain(stream) == std::vector<int>{ 0 },
+                 "The first value is not a change");
+    static_cast<void>(stream.Push(103));
+    static_cast<void>(stream.Push(98));
+    test::Assert(Drain(stream) == std::vector<int>{ -2 },
+                 "Difference since the last drain");
+}
+
+void TestAccumulateAfterKeepAll()
+{
+    // Switching an absolute stream to accumulation must not report the
+    // distance from zero as a change.
+    event_stream<int> stream(8);
+    static_cast<void>(stream.Push(500));
+    static_cast<void>(Drain(stream));
+    stream.SetCoalescing(event_coalescing::ACCUMULATE);
+    static_cast<void>(stream.Push(510));
+    test::Assert(Drain(stream) == std::vector<int>{ 10 },
+                 "Change since the last value");
+}
+
+void TestAccumulateWithoutArithmetic()
+{
+    event_stream<label> stream(2);
+    stream.SetCoalescing(event_coalescing::ACCUMULATE);
+    static_cast<void>(stream.Push({ 1 }));
+    static_cast<void>(stream.Push({ 2 }));
+    std::vector<label> drained = Drain(stream);
+    test::Assert(drained.size() == 1 && drained[0].id == 2,
+                 "The latest value is kept");
+}
+
+void TestDropNewest()
+{
+    event_stream<int> stream(2);
+    test::Assert(stream.Push(0) && stream.Push(1), "Push with room");
+    test::Assert(!stream.Push(2), "Push into a full stream");
+    test::Assert(!stream.TryPush(3), "TryPush into a full stream");
+    test::Assert(stream.GetDropped() == 2, "Dropped count");
+    test::Assert(Drain(stream) == std::vector<int>{ 0, 1 },
+                 "The oldest values remain");
+}
+
+void TestDropOldest()
+{
+    event_stream<int> stream(2);
+    stream.SetOverflow(event_overflow::DROP_OLDEST);
+    for (int i = 0; i < 5; ++i) {
+        test::Assert(stream.Push(i), "Push drops the oldest value");
+    }
+    test::Assert(stream.GetDropped() == 3, "Dropped count");
+    std::vector<int> drained = Drain(stream);
+    test::Assert(drained == std::vector<int>{ 3, 4 },
+                 "The newest values remain");
+}
+
+void TestDropOldestAfterDrain()
+{
+    // Values held by the consumer do not take room from new values, so the
+    // oldest values are still dropped after a drain.
+    event_stream<int> stream(4);
+    stream.SetOverflow(event_overflow::DROP_OLDEST);
+    static_cast<void>(stream.Push(1));
+    test::Assert(Drain(stream) == std::vector<int>{ 1 }, "First drain");
+    for (int i = 0; i < 10; ++i) {
+        test::Assert(stream.Push(i), "Push while a drained value is held");
+    }
+    test::Assert(stream.GetDropped() == 6, "Dropped count");
+    test::Assert(Drain(stream) == std::vector<int>{ 6, 7, 8, 9 },
+                 "The newest values remain");
+}
+
+void TestBlockTryPush()
+{
+    event_stream<int> stream(2);
+    stream.SetOverflow(event_overflow::BLOCK);
+    static_cast<void>(stream.Push(0));
+    static_cast<void>(stream.Push(1));
+    test::Assert(!stream.TryPush(2), "TryPush into a full stream");
+    test::Assert(stream.GetDropped() == 0,
+                 "A refused TryPush is not counted as dropped");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Keep all", TestKeepAll);
+    passed &= test::ForThrow("Keep latest", TestKeepLatest);
+    passed &= test::ForThrow("Accumulate relative", TestAccumulateRelative);
+    passed &= test::ForThrow("Accumulate absolute", TestAccumulateAbsolute);
+    passed &= test::ForThrow("Accumulate after keep all",
+                             TestAccumulateAfterKeepAll);
+    passed &= test::ForThrow("Accumulate without arithmetic",
+                             TestAccumulateWithoutArithmetic);
+    passed &= test::ForThrow("Drop newest", TestDropNewest);
+    passed &= test::ForThrow("Drop oldest", TestDropOldest);
+    passed &= test::ForThrow("Drop oldest after a drain",
+                             TestDropOldestAfterDrain);
+    passed &= test::ForThrow("Block with TryPush", TestBlockTryPush);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
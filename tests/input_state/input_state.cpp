@@ -0,0 +1,102 @@
+// Standard includes
+#include <cstdlib>
+
+// Local includes
+#include "../../src/input_state.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+using gvw::internal::input_state;
+
+/// @brief Spans more than one word so that indices past the first are tested.
+using table = input_state<100>;
+
+void TestEdges()
+{
+    table state;
+    for (size_t index : { 0, 63, 64, 99 }) {
+        test::Assert(!state.IsDown(index), "Up by default");
+        state.Set(index, true);
+        test::Assert(state.IsDown(index), "Down after a press");
+        test::Assert(state.WasPressed(index), "Pressed after a press");
+        test::Assert(!state.WasReleased(index), "Not released after a press");
+        state.Set(index, false);
+        test::Assert(!state.IsDown(index), "Up after a release");
+        test::Assert(state.WasPressed(index), "Press is kept for the frame");
+        test::Assert(state.WasReleased(index), "Released after a release");
+    }
+    test::Assert(!state.IsDown(1) && !state.WasPressed(1),
+                 "Other inputs are untouched");
+}
+
+void TestRepeatedSetIsNotAnEdge()
+{
+    table state;
+    state.Set(5, true);
+    state.NextFrame();
+    state.Set(5, true);
+    test::Assert(!state.WasPressed(5), "A repeated press is not an edge");
+    state.Set(6, false);
+    test::Assert(!state.WasReleased(6), "Releasing an up input is not an edge");
+}
+
+void TestNextFrame()
+{
+    table state;
+    state.Set(10, true);
+    state.Set(11, true);
+    state.Set(11, false);
+    state.NextFrame();
+    test::Assert(state.IsDown(10), "Down inputs stay down");
+    test::Assert(!state.WasPressed(10), "Presses are forgotten");
+    test::Assert(!state.WasReleased(11), "Releases are forgotten");
+}
+
+void TestOutOfRange()
+{
+    table state;
+    state.Set(100, true);
+    state.Set(static_cast<size_t>(-1), true);
+    test::Assert(!state.IsDown(100), "Index equal to the count");
+    test::Assert(!state.WasPressed(100), "Out of range press");
+    test::Assert(!state.IsDown(static_cast<size_t>(-1)), "Largest index");
+}
+
+void TestSticky()
+{
+    table state;
+    state.SetSticky(true);
+    state.Set(70, true);
+    state.Set(70, false);
+    test::Assert(state.IsDown(70), "A sticky release is reported once");
+    test::Assert(!state.IsDown(70), "The sticky release is consumed");
+
+    state.Set(71, true);
+    state.Set(71, false);
+    state.Set(71, true);
+    state.Set(71, false);
+    state.Set(71, true);
+    test::Assert(state.IsDown(71), "Down again");
+    state.Set(71, false);
+    test::Assert(state.IsDown(71), "Released after pressing again");
+    test::Assert(!state.IsDown(71), "Only one query sees the release");
+
+    state.Set(72, true);
+    state.Set(72, false);
+    state.SetSticky(false);
+    test::Assert(!state.IsDown(72), "Disabling forgets sticky releases");
+    state.Set(73, true);
+    state.Set(73, false);
+    test::Assert(!state.IsDown(73), "Releases are immediate when disabled");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Edges", TestEdges);
+    passed &= test::ForThrow("Repeated set is not an edge",
+                             TestRepeatedSetIsNotAnEdge);
+    passed &= test::ForThrow("Next frame", TestNextFrame);
+    passed &= test::ForThrow("Out of range", TestOutOfRange);
+    passed &= test::ForThrow("Sticky", TestSticky);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,234 @@
+// Standard includes
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+// Local includes
+#include "../../src/pixel_conversion.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+using gvw::internal::pixel_conversion_isa;
+
+namespace {
+
+/// @brief Pixel counts around every vector width and a large count.
+const std::vector<size_t> PIXEL_COUNTS = []() { // NOLINT
+    std::vector<size_t> counts;
+    for (size_t count = 0; count < 70; ++count) {
+        counts.push_back(count);
+    }
+    counts.push_back(4099);
+    return counts;
+}();
+
+} // namespace
+
+std::vector<uint8_t> RandomBytes(size_t Size)
+{
+    static std::mt19937 generator(1234); // NOLINT
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::vector<uint8_t> bytes(Size);
+    for (uint8_t& byte : bytes) {
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+    return bytes;
+}
+
+std::vector<uint8_t> ReferenceExpand(const std::vector<uint8_t>& Source,
+                                     int Components)
+{
+    auto components = static_cast<size_t>(Components);
+    size_t pixelCount = Source.size() / components;
+    std::vector<uint8_t> rgba(pixelCount * 4);
+    for (size_t i = 0; i < pixelCount; ++i) {
+        const uint8_t* pixel = &Source[i * components];
+        uint8_t* out = &rgba[i * 4];
+        switch (Components) {
+            case 1:
+                out[0] = out[1] = out[2] = pixel[0];
+                out[3] = 255;
+                break;
+            case 2:
+                out[0] = out[1] = out[2] = pixel[0];
+                out[3] = pixel[1];
+                break;
+            case 3:
+                out[0] = pixel[0];
+                out[1] = pixel[1];
+                out[2] = pixel[2];
+                out[3] = 255;
+                break;
+            default:
+                out[0] = pixel[0];
+                out[1] = pixel[1];
+                out[2] = pixel[2];
+                out[3] = pixel[3];
+                break;
+        }
+    }
+    return rgba;
+}
+
+std::vector<uint8_t> ReferenceSwizzle(std::vector<uint8_t> Pixels)
+{
+    for (size_t i = 0; i + 3 < Pixels.size(); i += 4) {
+        std::swap(Pixels[i], Pixels[i + 2]);
+    }
+    return Pixels;
+}
+
+std::vector<uint8_t> ReferencePremultiply(std::vector<uint8_t> Pixels)
+{
+    for (size_t i = 0; i + 3 < Pixels.size(); i += 4) {
+        unsigned alpha = Pixels[i + 3];
+        for (size_t component = 0; component < 3; ++component) {
+            // The product is never exactly halfway between two integers, so
+            // this rounds to the nearest value.
+            Pixels[i + component] = static_cast<uint8_t>(
+                (Pixels[i + component] * alpha + 127) / 255);
+        }
+    }
+    return Pixels;
+}
+
+/// @brief Returns the instruction sets to test: scalar and the best one
+/// supported by this processor.
+std::vector<pixel_conversion_isa> IsasToTest()
+{
+    std::vector<pixel_conversion_isa> isas = { pixel_conversion_isa::SCALAR };
+    if (gvw::internal::GetPixelConversionIsa() !=
+        pixel_conversion_isa::SCALAR) {
+        isas.push_back(gvw::internal::GetPixelConversionIsa());
+    }
+    return isas;
+}
+
+std::string Describe(pixel_conversion_isa Isa, size_t Pixel_Count)
+{
+    return std::string(gvw::internal::GetPixelConversionIsaName(Isa)) +
+           " with " + std::to_string(Pixel_Count) + " pixels";
+}
+
+void TestExpandToRgba()
+{
+    for (pixel_conversion_isa isa : IsasToTest()) {
+        for (int components = 1; components <= 4; ++components) {
+            for (size_t count : PIXEL_COUNTS) {
+                std::vector<uint8_t> source =
+                    RandomBytes(count * static_cast<size_t>(components));
+                std::vector<uint8_t> destination(count * 4);
+                gvw::internal::ExpandToRgba(
+                    source, components, destination, isa);
+                test::Assert(destination == ReferenceExpand(source, components),
+                             std::to_string(components) + " components on " +
+                                 Describe(isa, count));
+            }
+        }
+    }
+}
+
+void TestExpandFunctions()
+{
+    for (pixel_conversion_isa isa : IsasToTest()) {
+        for (size_t count : PIXEL_COUNTS) {
+            std::vector<uint8_t> grey = RandomBytes(count);
+            std::vector<uint8_t> greyAlpha = RandomBytes(count * 2);
+            std::vector<uint8_t> rgb = RandomBytes(count * 3);
+            std::vector<uint8_t> destination(count * 4);
+
+            gvw::internal::ExpandGreyToRgba(grey, destination, isa);
+            test::Assert(destination == ReferenceExpand(grey, 1),
+                         "Grey on " + Describe(isa, count));
+            gvw::internal::ExpandGreyAlphaToRgba(greyAlpha, destination, isa);
+            test::Assert(destination == ReferenceExpand(greyAlpha, 2),
+                         "Grey and alpha on " + Describe(isa, count));
+            gvw::internal::ExpandRgbToRgba(rgb, destination, isa);
+            test::Assert(destination == ReferenceExpand(rgb, 3),
+                         "RGB on " + Describe(isa, count));
+        }
+    }
+}
+
+void TestSwizzle()
+{
+    for (pixel_conversion_isa isa : IsasToTest()) {
+        for (size_t count : PIXEL_COUNTS) {
+            std::vector<uint8_t> source = RandomBytes(count * 4);
+            std::vector<uint8_t> destination(count * 4);
+            gvw::internal::SwizzleRgbaToBgra(source, destination, isa);
+            test::Assert(destination == ReferenceSwizzle(source),
+                         "Swizzle on " + Describe(isa, count));
+            gvw::internal::SwizzleRgbaToBgra(destination, destination, isa);
+            test::Assert(destination == source,
+                         "Swizzle in place on " + Describe(isa, count));
+        }
+    }
+}
+
+void TestPremultiplyAlpha()
+{
+    // Every color and alpha pair.
+    std::vector<uint8_t> everyPair;
+    for (int color = 0; color < 256; ++color) {
+        for (int alpha = 0; alpha < 256; ++alpha) {
+            everyPair.insert(everyPair.end(),
+                             { static_cast<uint8_t>(color),
+                               static_cast<uint8_t>(255 - color),
+                               static_cast<uint8_t>(color ^ alpha),
+                               static_cast<uint8_t>(alpha) });
+        }
+    }
+
+    for (pixel_conversion_isa isa : IsasToTest()) {
+        std::vector<uint8_t> destination(everyPair.size());
+        gvw::internal::PremultiplyAlpha(everyPair, destination, isa);
+        test::Assert(destination == ReferencePremultiply(everyPair),
+                     "Every pair on " +
+                         Describe(isa, everyPair.size() / 4));
+
+        for (size_t count : PIXEL_COUNTS) {
+            std::vector<uint8_t> pixels = RandomBytes(count * 4);
+            std::vector<uint8_t> expected = ReferencePremultiply(pixels);
+            gvw::internal::PremultiplyAlpha(pixels, pixels, isa);
+            test::Assert(pixels == expected,
+                         "In place on " + Describe(isa, count));
+        }
+    }
+}
+
+void TestPremultiplyAlphaSrgb()
+{
+    std::vector<uint8_t> pixels = { 10, 128, 250, 255, 10, 128, 250, 0,
+                                    255, 255, 255, 128, 0, 0, 0, 77 };
+    std::vector<uint8_t> destination(pixels.size());
+    gvw::internal::PremultiplyAlphaSrgb(pixels, destination);
+    test::Assert(std::equal(pixels.begin(), pixels.begin() + 4,
+                            destination.begin()),
+                 "Opaque pixels are unchanged");
+    test::Assert(destination[4] == 0 && destination[5] == 0 &&
+                     destination[6] == 0 && destination[7] == 0,
+                 "Transparent pixels are black");
+    test::Assert(destination[8] == destination[9] &&
+                     destination[9] == destination[10] &&
+                     destination[11] == 128,
+                 "Alpha is kept");
+    // Premultiplying in linear space keeps more of the color than
+    // premultiplying the encoded values.
+    test::Assert(destination[8] > 128, "White at half alpha");
+    test::Assert(destination[12] == 0 && destination[15] == 77,
+                 "Black stays black");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Expand to RGBA", TestExpandToRgba);
+    passed &= test::ForThrow("Expand functions", TestExpandFunctions);
+    passed &= test::ForThrow("Swizzle", TestSwizzle);
+    passed &= test::ForThrow("Premultiply alpha", TestPremultiplyAlpha);
+    passed &= test::ForThrow("Premultiply alpha in sRGB",
+                             TestPremultiplyAlphaSrgb);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
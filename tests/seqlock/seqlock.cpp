@@ -0,0 +1,72 @@
+// Standard includes
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+
+// Local includes
+#include "../../src/seqlock.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+using gvw::internal::seqlock;
+
+/// @brief Larger than a word and not a multiple of one, so a torn read would
+/// mix fields from different stores.
+struct triple
+{
+    uint64_t a;
+    uint64_t b;
+    uint32_t c;
+};
+
+void TestStoreAndLoad()
+{
+    seqlock<triple> lock;
+    triple initial = lock.Load();
+    test::Assert(initial.a == 0 && initial.b == 0 && initial.c == 0,
+                 "Default value");
+
+    lock.Store({ 1, 2, 3 });
+    triple loaded = lock.Load();
+    test::Assert(loaded.a == 1 && loaded.b == 2 && loaded.c == 3, "Load");
+
+    seqlock<int> constructed(42);
+    test::Assert(constructed.Load() == 42, "Constructed value");
+}
+
+void TestConcurrentLoadsAreNotTorn()
+{
+    const uint64_t COUNT = 200000;
+    seqlock<triple> lock;
+    std::atomic<bool> done = false;
+    std::thread writer([&lock, &done]() {
+        for (uint64_t i = 1; i <= COUNT; ++i) {
+            lock.Store({ i, i * 3, static_cast<uint32_t>(i * 7) });
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    bool consistent = true;
+    uint64_t previous = 0;
+    bool ordered = true;
+    while (!done.load(std::memory_order_acquire)) {
+        triple loaded = lock.Load();
+        consistent = consistent && loaded.b == loaded.a * 3 &&
+                     loaded.c == static_cast<uint32_t>(loaded.a * 7);
+        ordered = ordered && loaded.a >= previous;
+        previous = loaded.a;
+    }
+    writer.join();
+    test::Assert(consistent, "Loads never mix two stores");
+    test::Assert(ordered, "Loads never go back in time");
+    test::Assert(lock.Load().a == COUNT, "The last store is visible");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Store and load", TestStoreAndLoad);
+    passed &= test::ForThrow("Concurrent loads are not torn",
+                             TestConcurrentLoadsAreNotTorn);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
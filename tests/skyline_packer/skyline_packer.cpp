@@ -0,0 +1,142 @@
+// Standard includes
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Local includes
+#include "../../gvw/gvw.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+using gvw::internal::skyline_packer;
+
+struct placed
+{
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+};
+
+bool Overlap(const placed& A, const placed& B)
+{
+    return A.x < B.x + B.width && B.x < A.x + A.width &&
+           A.y < B.y + B.height && B.y < A.y + A.height;
+}
+
+/// @brief Inserts a rectangle and checks that it is in bounds and does not
+/// overlap any rectangle placed before it.
+bool Insert(skyline_packer& Packer,
+            uint32_t Bin_Width,
+            uint32_t Bin_Height,
+            uint32_t Width,
+            uint32_t Height,
+            std::vector<placed>& Placed)
+{
+    std::optional<gvw::coordinate<uint32_t>> corner =
+        Packer.Insert(Width, Height);
+    if (!corner.has_value()) {
+        return false;
+    }
+    placed rectangle = { corner->x, corner->y, Width, Height };
+    test::Assert(rectangle.x + Width <= Bin_Width &&
+                     rectangle.y + Height <= Bin_Height,
+                 "Rectangle out of bounds");
+    for (const placed& other : Placed) {
+        test::Assert(!Overlap(rectangle, other), "Rectangles overlap");
+    }
+    Placed.push_back(rectangle);
+    return true;
+}
+
+void TestRejectInvalidSizes()
+{
+    skyline_packer packer(64, 32);
+    test::Assert(!packer.Insert(0, 10).has_value(), "Zero width");
+    test::Assert(!packer.Insert(10, 0).has_value(), "Zero height");
+    test::Assert(!packer.Insert(65, 1).has_value(), "Too wide");
+    test::Assert(!packer.Insert(1, 33).has_value(), "Too tall");
+    test::Assert(packer.Insert(64, 32).has_value(), "Exactly the bin size");
+    test::Assert(!packer.Insert(1, 1).has_value(), "Full bin");
+}
+
+void TestGridFillsExactly()
+{
+    const uint32_t binSize = 128;
+    const uint32_t cellSize = 16;
+    skyline_packer packer(binSize, binSize);
+    std::vector<placed> placedRectangles;
+    const uint32_t cellCount = (binSize / cellSize) * (binSize / cellSize);
+    for (uint32_t i = 0; i < cellCount; ++i) {
+        test::Assert(Insert(packer,
+                            binSize,
+                            binSize,
+                            cellSize,
+                            cellSize,
+                            placedRectangles),
+                     "Cell " + std::to_string(i) + " does not fit");
+    }
+    test::Assert(!packer.Insert(cellSize, cellSize).has_value(),
+                 "A cell fits in a full bin");
+    test::Assert(!packer.Insert(1, 1).has_value(),
+                 "A pixel fits in a full bin");
+}
+
+void TestPlacesLowestFirst()
+{
+    skyline_packer packer(100, 100);
+    std::vector<placed> placedRectangles;
+    for (auto [width, height] : { std::pair<uint32_t, uint32_t>{ 60, 50 },
+                                  { 40, 10 },
+                                  { 40, 20 } }) {
+        test::Assert(
+            Insert(packer, 100, 100, width, height, placedRectangles),
+            "Rectangle does not fit");
+    }
+    // The third rectangle rests lower on the second than on the first.
+    test::Assert(placedRectangles[1].x == 60 && placedRectangles[1].y == 0,
+                 "Second rectangle is on the floor");
+    test::Assert(placedRectangles[2].x == 60 && placedRectangles[2].y == 10,
+                 "Third rectangle rests on the second");
+}
+
+void TestRandomRectangles()
+{
+    std::mt19937 generator(42); // NOLINT
+    std::uniform_int_distribution<uint32_t> size(1, 40);
+    for (int bin = 0; bin < 20; ++bin) {
+        const uint32_t binWidth = 100 + static_cast<uint32_t>(bin) * 13;
+        const uint32_t binHeight = 150;
+        skyline_packer packer(binWidth, binHeight);
+        std::vector<placed> placedRectangles;
+        uint64_t area = 0;
+        for (int i = 0; i < 200; ++i) {
+            uint32_t width = size(generator);
+            uint32_t height = size(generator);
+            if (Insert(packer,
+                       binWidth,
+                       binHeight,
+                       width,
+                       height,
+                       placedRectangles)) {
+                area += uint64_t{ width } * height;
+            }
+        }
+        test::Assert(area <= uint64_t{ binWidth } * binHeight,
+                     "Placed more area than the bin holds");
+        test::Assert(!placedRectangles.empty(), "Nothing was placed");
+    }
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Reject invalid sizes", TestRejectInvalidSizes);
+    passed &= test::ForThrow("Grid fills exactly", TestGridFillsExactly);
+    passed &= test::ForThrow("Places lowest first", TestPlacesLowestFirst);
+    passed &= test::ForThrow("Random rectangles", TestRandomRectangles);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
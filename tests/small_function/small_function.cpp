@@ -0,0 +1,143 @@
+// Standard includes
+#include <array>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+
+// Local includes
+#include "../../src/small_function.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+using gvw::internal::small_function;
+
+namespace {
+
+int MOVES = 0; // NOLINT
+int LIVE = 0;  // NOLINT
+
+} // namespace
+
+/// @brief A callable that counts its moves and live instances. Moving a
+/// `small_function` moves an inline callable but not a heap callable.
+template<size_t SIZE>
+struct counted
+{
+    std::array<char, SIZE> padding = {};
+    int value;
+
+    explicit counted(int Value)
+        : value(Value)
+    {
+        ++LIVE;
+    }
+    counted(const counted& Other)
+        : padding(Other.padding)
+        , value(Other.value)
+    {
+        ++LIVE;
+    }
+    counted(counted&& Other) noexcept
+        : padding(Other.padding)
+        , value(Other.value)
+    {
+        ++LIVE;
+        ++MOVES;
+    }
+    counted& operator=(const counted&) = delete;
+    counted& operator=(counted&&) noexcept = delete;
+    ~counted()
+    {
+        --LIVE;
+    }
+
+    int operator()(int Argument) const
+    {
+        return this->value + Argument;
+    }
+};
+
+using function = small_function<int(int)>;
+using small = counted<8>;
+using large = counted<256>;
+
+void TestEmpty()
+{
+    function empty;
+    test::Assert(!empty, "Default constructed");
+    function null = nullptr;
+    test::Assert(!null, "Constructed from nullptr");
+    int (*pointer)(int) = nullptr;
+    function fromNullPointer = pointer;
+    test::Assert(!fromNullPointer, "Constructed from a null pointer");
+}
+
+void TestCall()
+{
+    function lambda = [](int Argument) { return Argument * 2; };
+    test::Assert(lambda(21) == 42, "Lambda");
+    int (*pointer)(int) = [](int Argument) { return Argument + 1; };
+    function fromPointer = pointer;
+    test::Assert(fromPointer(1) == 2, "Function pointer");
+    std::unique_ptr<int> owned = std::make_unique<int>(7);
+    small_function<int()> moveOnly = [owned = std::move(owned)]() {
+        return *owned;
+    };
+    test::Assert(moveOnly() == 7, "Move only lambda");
+}
+
+void TestInline()
+{
+    LIVE = 0;
+    {
+        function first = small(1);
+        MOVES = 0;
+        function second = std::move(first);
+        test::Assert(MOVES == 1, "Moving moves an inline callable");
+        test::Assert(!first, "Moved from is empty"); // NOLINT
+        test::Assert(second(1) == 2, "Call after a move");
+        test::Assert(LIVE == 1, "Moved from callable is destroyed");
+    }
+    test::Assert(LIVE == 0, "Inline callable is destroyed");
+}
+
+void TestHeap()
+{
+    LIVE = 0;
+    {
+        function first = large(1);
+        MOVES = 0;
+        function second = std::move(first);
+        test::Assert(MOVES == 0, "Moving does not move a heap callable");
+        test::Assert(!first, "Moved from is empty"); // NOLINT
+        test::Assert(second(2) == 3, "Call after a move");
+        test::Assert(LIVE == 1, "One heap callable");
+    }
+    test::Assert(LIVE == 0, "Heap callable is destroyed");
+}
+
+void TestAssignAndReset()
+{
+    LIVE = 0;
+    function target = small(1);
+    function source = large(10);
+    target = std::move(source);
+    test::Assert(LIVE == 1, "Assignment destroys the previous callable");
+    test::Assert(target(0) == 10, "Call after assignment");
+    target = small(5);
+    test::Assert(target(0) == 5, "Assign a callable");
+    test::Assert(LIVE == 1, "Assignment destroys the heap callable");
+    target.Reset();
+    test::Assert(!target, "Empty after a reset");
+    test::Assert(LIVE == 0, "Reset destroys the callable");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Empty", TestEmpty);
+    passed &= test::ForThrow("Call", TestCall);
+    passed &= test::ForThrow("Inline", TestInline);
+    passed &= test::ForThrow("Heap", TestHeap);
+    passed &= test::ForThrow("Assign and reset", TestAssignAndReset);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
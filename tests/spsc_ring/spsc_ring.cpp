@@ -0,0 +1,183 @@
+// Standard includes
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Local includes
+#include "../../src/spsc_ring.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+using gvw::internal::spsc_ring;
+using gvw::internal::spsc_ring_view;
+
+std::vector<int> ToVector(const spsc_ring_view<int>& View)
+{
+    return { View.begin(), View.end() };
+}
+
+void TestCapacity()
+{
+    test::Assert(spsc_ring<int>(0).Capacity() == 1, "Capacity of 0");
+    test::Assert(spsc_ring<int>(5).Capacity() == 8, "Capacity of 5");
+    test::Assert(spsc_ring<int>(8).Capacity() == 8, "Capacity of 8");
+
+    spsc_ring<int> ring(4);
+    for (int i = 0; i < 4; ++i) {
+        test::Assert(ring.TryPush(i), "Push into a ring with room");
+    }
+    test::Assert(!ring.TryPush(4), "Push into a full ring");
+    test::Assert(ring.Size() == 4, "Size of a full ring");
+}
+
+void TestRepeatedDrains()
+{
+    spsc_ring<int> ring(4);
+    int next = 0;
+    for (int round = 0; round < 10; ++round) {
+        std::vector<int> expected;
+        for (int i = 0; i < 3; ++i) {
+            test::Assert(ring.TryPush(next), "Push after a drain");
+            expected.push_back(next++);
+        }
+        test::Assert(ToVector(ring.Drain()) == expected,
+                     "Drained values in round " + std::to_string(round));
+    }
+    test::Assert(ring.Drain().Empty(), "Drain of an empty ring");
+}
+
+void TestHeldValuesAreNotOverwritten()
+{
+    spsc_ring<int> ring(4);
+    for (int i = 0; i < 4; ++i) {
+        static_cast<void>(ring.TryPush(i));
+    }
+    spsc_ring_view<int> view = ring.Drain();
+
+    // The drained values are held in the other ring, so new values get the
+    // full capacity and may be dropped without touching the held ones.
+    for (int i = 4; i < 8; ++i) {
+        test::Assert(ring.TryPush(i), "Push while the drained values are held");
+    }
+    test::Assert(!ring.TryPush(8), "Push into a full ring");
+    test::Assert(ring.TryDropOldest(), "Drop while values are held");
+    test::Assert(ring.TryPush(8), "Push after a drop");
+    test::Assert(ToVector(view) == std::vector<int>{ 0, 1, 2, 3 },
+                 "Held values are intact");
+
+    // The next drain releases them.
+    test::Assert(ToVector(ring.Drain()) == std::vector<int>{ 5, 6, 7, 8 },
+                 "Values pushed while others were held");
+}
+
+void TestDropOldest()
+{
+    spsc_ring<int> ring(4);
+    test::Assert(!ring.TryDropOldest(), "Drop from a ring with room");
+    for (int i = 0; i < 4; ++i) {
+        static_cast<void>(ring.TryPush(i));
+    }
+    for (int i = 4; i < 7; ++i) {
+        test::Assert(ring.TryDropOldest(), "Drop from a full ring");
+        test::Assert(ring.TryPush(i), "Push after a drop");
+    }
+    // Dropping moves the oldest value, so the remaining values wrap.
+    spsc_ring_view<int> view = ring.Drain();
+    test::Assert(ToVector(view) == std::vector<int>{ 3, 4, 5, 6 },
+                 "The newest values remain");
+    test::Assert(view.First().size() == 1 && view.Second().size() == 3,
+                 "Runs of a wrapped view");
+}
+
+void TestCopyPopAllAndClear()
+{
+    spsc_ring<int> ring(8);
+    for (int i = 0; i < 3; ++i) {
+        static_cast<void>(ring.TryPush(i));
+    }
+    test::Assert(ring.Copy() == std::vector<int>{ 0, 1, 2 }, "Copy");
+    test::Assert(ring.Size() == 3, "Copy does not remove values");
+
+    std::vector<int> popped = { -1 };
+    ring.PopAll(popped);
+    test::Assert(popped == std::vector<int>{ -1, 0, 1, 2 }, "PopAll appends");
+    test::Assert(ring.Size() == 0, "PopAll removes values");
+
+    static_cast<void>(ring.TryPush(3));
+    ring.Clear();
+    test::Assert(ring.Drain().Empty(), "Clear removes values");
+}
+
+void TestConcurrentOrder()
+{
+    const int COUNT = 100000;
+    spsc_ring<int> ring(64);
+    std::thread producer([&ring]() {
+        for (int i = 0; i < COUNT; ++i) {
+            while (!ring.TryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    bool ordered = true;
+    while (expected < COUNT) {
+        for (int value : ring.Drain()) {
+            ordered = ordered && (value == expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    test::Assert(ordered, "Values arrive in the order they were pushed");
+}
+
+void TestConcurrentDropOldest()
+{
+    const int COUNT = 100000;
+    spsc_ring<int> ring(8);
+    std::atomic<bool> done = false;
+    std::thread producer([&ring, &done]() {
+        for (int i = 0; i < COUNT; ++i) {
+            // Dropping fails while the consumer copies, so retry.
+            while (!ring.TryPush(i)) {
+                static_cast<void>(ring.TryDropOldest());
+            }
+        }
+        done.store(true);
+    });
+
+    // Values may be dropped, but the ones that arrive keep their order.
+    int previous = -1;
+    bool ordered = true;
+    bool finished = false;
+    while (!finished) {
+        finished = done.load();
+        for (int value : ring.Copy()) {
+            ordered = ordered && (value > previous);
+        }
+        for (int value : ring.Drain()) {
+            ordered = ordered && (value > previous);
+            previous = value;
+        }
+    }
+    producer.join();
+    test::Assert(ordered, "Values arrive in the order they were pushed");
+    test::Assert(previous == COUNT - 1, "The newest value arrives");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Capacity", TestCapacity);
+    passed &= test::ForThrow("Repeated drains", TestRepeatedDrains);
+    passed &= test::ForThrow("Held values are not overwritten",
+                             TestHeldValuesAreNotOverwritten);
+    passed &= test::ForThrow("Drop oldest", TestDropOldest);
+    passed &= test::ForThrow("Copy, PopAll, and Clear", TestCopyPopAllAndClear);
+    passed &= test::ForThrow("Concurrent order", TestConcurrentOrder);
+    passed &= test::ForThrow("Concurrent drop oldest",
+                             TestConcurrentDropOldest);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,153 @@
+// Standard includes
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+// Local includes
+#include "../../src/string_arena.hpp"
+#include "../../utils/unit-test/unit-test.hpp"
+
+using gvw::internal::string_arena;
+
+namespace {
+
+/// @brief The number of array allocations, which is how the arena allocates
+/// chunks.
+size_t ARRAY_ALLOCATIONS = 0; // NOLINT
+
+} // namespace
+
+void* operator new[](size_t Size)
+{
+    ++ARRAY_ALLOCATIONS;
+    if (void* memory = std::malloc(Size == 0 ? 1 : Size)) { // NOLINT
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete[](void* Memory) noexcept
+{
+    std::free(Memory); // NOLINT
+}
+
+void operator delete[](void* Memory, size_t /*Size*/) noexcept
+{
+    std::free(Memory); // NOLINT
+}
+
+/// @brief Returns a group of `Count` strings of `Length` characters.
+std::vector<std::string> MakeGroup(size_t Count, size_t Length, char First)
+{
+    std::vector<std::string> group;
+    for (size_t i = 0; i < Count; ++i) {
+        group.emplace_back(Length, static_cast<char>(First + i));
+    }
+    return group;
+}
+
+std::vector<const char*> Pointers(const std::vector<std::string>& Strings)
+{
+    std::vector<const char*> pointers;
+    for (const std::string& string : Strings) {
+        pointers.push_back(string.c_str());
+    }
+    return pointers;
+}
+
+void TestCopy()
+{
+    string_arena arena;
+    test::Assert(arena.Copy({}).empty(), "Copy of no strings");
+
+    std::vector<std::string> strings = { "first", "", "third path" };
+    std::vector<const char*> pointers = Pointers(strings);
+    auto views = arena.Copy(pointers);
+    test::Assert(views.size() == strings.size(), "Number of copies");
+    for (size_t i = 0; i < strings.size(); ++i) {
+        test::Assert(views[i] == strings[i], "Contents of a copy");
+        test::Assert(views[i].data() != strings[i].c_str(),
+                     "Copies do not alias the originals");
+        test::Assert(views[i].data()[views[i].size()] == '\0',
+                     "Copies are null terminated");
+    }
+
+    // Earlier copies stay valid while later groups allocate new chunks.
+    std::vector<std::string> large = MakeGroup(4, 3000, 'a');
+    std::vector<const char*> largePointers = Pointers(large);
+    auto largeViews = arena.Copy(largePointers);
+    test::Assert(largeViews[3] == large[3], "Contents of a large copy");
+    test::Assert(views[2] == strings[2], "Earlier copies are still valid");
+}
+
+void TestResetConsolidates()
+{
+    std::vector<std::vector<std::string>> groups;
+    for (size_t i = 0; i < 8; ++i) {
+        // Odd lengths so that groups need padding when packed together.
+        groups.push_back(MakeGroup(i + 1, 1000 + (i * 7), 'a'));
+    }
+    std::vector<std::vector<const char*>> pointers;
+    for (const auto& group : groups) {
+        pointers.push_back(Pointers(group));
+    }
+
+    string_arena arena;
+    size_t before = ARRAY_ALLOCATIONS;
+    for (const auto& group : pointers) {
+        static_cast<void>(arena.Copy(group));
+    }
+    test::Assert(ARRAY_ALLOCATIONS - before > 1,
+                 "The first pass needs more than one chunk");
+
+    arena.Reset();
+    for (int pass = 0; pass < 3; ++pass) {
+        before = ARRAY_ALLOCATIONS;
+        for (size_t i = 0; i < pointers.size(); ++i) {
+            auto views = arena.Copy(pointers[i]);
+            test::Assert(views.back() == groups[i].back(),
+                         "Contents after a reset");
+        }
+        test::Assert(ARRAY_ALLOCATIONS == before,
+                     "Copying the same groups after a reset allocates nothing");
+        arena.Reset();
+    }
+}
+
+void TestRewind()
+{
+    std::vector<std::string> kept = { "kept" };
+    std::vector<std::string> large = MakeGroup(2, 5000, 'x');
+    std::vector<const char*> keptPointers = Pointers(kept);
+    std::vector<const char*> largePointers = Pointers(large);
+
+    string_arena arena;
+    auto keptViews = arena.Copy(keptPointers);
+    string_arena::mark mark = arena.GetMark();
+
+    // A rewind within the same chunk reuses the released bytes.
+    auto first = arena.Copy(keptPointers);
+    arena.Rewind(mark);
+    test::Assert(arena.GetMark() == mark, "Mark after a rewind");
+    auto second = arena.Copy(keptPointers);
+    test::Assert(first.data() == second.data(), "Released bytes are reused");
+
+    // A rewind past a new chunk releases the chunk.
+    arena.Rewind(mark);
+    static_cast<void>(arena.Copy(largePointers));
+    test::Assert(!(arena.GetMark() == mark), "Mark after a new chunk");
+    arena.Rewind(mark);
+    test::Assert(arena.GetMark() == mark, "Mark after releasing a chunk");
+    test::Assert(keptViews[0] == "kept", "Copies before the mark are valid");
+}
+
+int main()
+{
+    bool passed = true;
+    passed &= test::ForThrow("Copy", TestCopy);
+    passed &= test::ForThrow("Reset consolidates", TestResetConsolidates);
+    passed &= test::ForThrow("Rewind", TestRewind);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file main.cpp
+ * @author Caden Shmookler (cshmookler@gmail.com)
+ * @brief Packs files into a GVW archive.
+ * @date 2023-09-24
+ *
+ * Usage: gvw_archive_packer <OUTPUT> <BASE_DIRECTORY> <FILES...>
+ *
+ * Entries are named by their path relative to BASE_DIRECTORY with forward
+ * slashes.
+ */
+
+// Standard includes
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Local includes
+#include "../../src/archive_format.hpp"
+
+namespace {
+
+struct packed_file
+{
+    std::string name;
+    std::vector<char> data;
+};
+
+uint64_t AlignUp(uint64_t Value, uint64_t Alignment)
+{
+    return (Value + Alignment - 1) / Alignment * Alignment;
+}
+
+template<typename T>
+void Write(std::vector<char>& Archive, uint64_t Offset, const T& Value)
+{
+    std::memcpy(Archive.data() + Offset, &Value, sizeof(T));
+}
+
+} // namespace
+
+int main(int Argc, char** Argv)
+{
+    if constexpr (std::endian::native != std::endian::little) {
+        std::cerr << "GVW archives can only be packed on little endian hosts."
+                  << std::endl;
+        return 1;
+    }
+    if (Argc < 3) {
+        std::cerr << "Usage: " << Argv[0] // NOLINT
+                  << " <OUTPUT> <BASE_DIRECTORY> <FILES...>" << std::endl;
+        return 1;
+    }
+    std::filesystem::path outputPath = Argv[1];    // NOLINT
+    std::filesystem::path baseDirectory = Argv[2]; // NOLINT
+
+    // Read every file.
+    std::vector<packed_file> files;
+    for (int i = 3; i < Argc; ++i) {
+        std::filesystem::path path = Argv[i]; // NOLINT
+        if (path.is_relative()) {
+            path = baseDirectory / path;
+        }
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open \"" << path.string() << "\"."
+                      << std::endl;
+            return 1;
+        }
+        files.push_back(
+            { .name = std::filesystem::relative(path, baseDirectory)
+                          .generic_string(),
+              .data = std::vector<char>(std::istreambuf_iterator<char>(file),
+                                        std::istreambuf_iterator<char>()) });
+    }
+
+    for (size_t i = 0; i < files.size(); ++i) {
+        for (size_t j = i + 1; j < files.size(); ++j) {
+            if (files.at(i).name == files.at(j).name) {
+                std::cerr << "\"" << files.at(i).name
+                          << "\" was added to the archive twice." << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    // Keep the table of contents at most half full so probes stay short.
+    auto tableSize = static_cast<uint32_t>(
+        std::bit_ceil(std::max<size_t>(files.size() * 2, 1)));
+
+    // Lay out the header, the table of contents, the names, and the blobs.
+    uint64_t namesOffset = sizeof(gvw::internal::archive_header) +
+                           (tableSize * sizeof(gvw::internal::archive_entry));
+    uint64_t archiveSize = namesOffset;
+    for (const auto& file : files) {
+        archiveSize += file.name.size();
+    }
+    std::vector<gvw::internal::archive_entry> table(tableSize);
+    // The name and blob offsets of each file.
+    std::vector<std::pair<uint64_t, uint64_t>> entryOffsets;
+    uint64_t nameOffset = namesOffset;
+    for (const auto& file : files) {
+        archiveSize =
+            AlignUp(archiveSize, gvw::internal::ARCHIVE_BLOB_ALIGNMENT);
+        gvw::internal::archive_entry entry = {
+            .nameHash = gvw::internal::HashArchiveName(file.name),
+            .nameOffset = nameOffset,
+            .dataOffset = archiveSize,
+            .dataSize = file.data.size(),
+            .nameSize = static_cast<uint32_t>(file.name.size()),
+            .padding = 0
+        };
+        entryOffsets.emplace_back(entry.nameOffset, entry.dataOffset);
+        nameOffset += file.name.size();
+        archiveSize += file.data.size();
+
+        auto slot = static_cast<uint32_t>(entry.nameHash & (tableSize - 1));
+        while (table.at(slot).nameSize != 0) {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+        table.at(slot) = entry;
+    }
+
+    // Write everything into one buffer.
+    std::vector<char> archive(archiveSize, 0);
+    Write(archive,
+          0,
+          gvw::internal::archive_header{
+              .magic = gvw::internal::ARCHIVE_MAGIC,
+              .version = gvw::internal::ARCHIVE_VERSION,
+              .tableSize = tableSize,
+              .entryCount = static_cast<uint32_t>(files.size()) });
+    for (uint32_t slot = 0; slot < tableSize; ++slot) {
+        Write(archive,
+              sizeof(gvw::internal::archive_header) +
+                  (slot * sizeof(gvw::internal::archive_entry)),
+              table.at(slot));
+    }
+    for (size_t i = 0; i < files.size(); ++i) {
+        std::memcpy(archive.data() + entryOffsets.at(i).first,
+                    files.at(i).name.data(),
+                    files.at(i).name.size());
+        std::memcpy(archive.data() + entryOffsets.at(i).second,
+                    files.at(i).data.data(),
+                    files.at(i).data.size());
+    }
+
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+    if (!output.is_open()) {
+        std::cerr << "Failed to create \"" << outputPath.string() << "\"."
+                  << std::endl;
+        return 1;
+    }
+    output.write(archive.data(), static_cast<std::streamsize>(archive.size()));
+    return output.good() ? 0 : 1;
+}
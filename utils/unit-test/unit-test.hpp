@@ -3,6 +3,8 @@
 // Standard includes
 #include <iostream>
 #include <exception>
+#include <stdexcept>
+#include <string>
 #include <mutex>
 
 // Local includes
@@ -23,6 +25,15 @@ void SynchronizedPrintToConsole(const std::string& Message)
     std::cout << Message;
 }
 
+/// @brief Throws a std::runtime_error with the message if the condition is
+/// false. Meant to be called from functions passed to `ForThrow`.
+void Assert(bool Condition, const std::string& Message)
+{
+    if (!Condition) {
+        throw std::runtime_error(Message);
+    }
+}
+
 /// @warning Only std::runtime_error exceptions are caught.
 template<typename Func, typename... Args>
 bool ForThrow(const char* Name, Func&& Function, Args&&... Arguments)